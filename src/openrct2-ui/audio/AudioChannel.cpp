@@ -285,6 +285,11 @@ namespace OpenRCT2 { namespace Audio
                         _offset = 0;
                     }
                 }
+                else if (readLen == 0)
+                {
+                    // Source has no data ready yet (e.g. a stream still buffering)
+                    break;
+                }
             }
             return bytesRead;
         }
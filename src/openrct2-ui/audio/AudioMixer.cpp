@@ -94,6 +94,11 @@ namespace OpenRCT2 { namespace Audio
         Buffer _convertBuffer;
         Buffer _effectBuffer;
 
+        // Conversion filter for the last source format seen, most streams share the same format
+        AudioFormat _cvtFormat = { 0 };
+        SDL_AudioCVT _cvt = { 0 };
+        bool _cvtValid = false;
+
     public:
         AudioMixerImpl()
         {
@@ -127,6 +132,7 @@ namespace OpenRCT2 { namespace Audio
             _format.format = have.format;
             _format.channels = have.channels;
             _format.freq = have.freq;
+            _cvtValid = false;
 
             LoadAllSounds();
 
@@ -311,7 +317,7 @@ namespace OpenRCT2 { namespace Audio
             AudioFormat streamformat = channel->GetFormat();
             if (streamformat != _format)
             {
-                if (SDL_BuildAudioCVT(&cvt, streamformat.format, streamformat.channels, streamformat.freq, _format.format, _format.channels, _format.freq) == -1)
+                if (!GetAudioCVT(streamformat, &cvt))
                 {
                     // Unable to convert channel data
                     return;
@@ -366,6 +372,22 @@ namespace OpenRCT2 { namespace Audio
             channel->UpdateOldVolume();
         }
 
+        bool GetAudioCVT(const AudioFormat &srcFormat, SDL_AudioCVT * cvt)
+        {
+            if (!_cvtValid || _cvtFormat != srcFormat)
+            {
+                _cvtValid = false;
+                if (SDL_BuildAudioCVT(&_cvt, srcFormat.format, srcFormat.channels, srcFormat.freq, _format.format, _format.channels, _format.freq) == -1)
+                {
+                    return false;
+                }
+                _cvtFormat = srcFormat;
+                _cvtValid = true;
+            }
+            *cvt = _cvt;
+            return true;
+        }
+
         /**
          * Resample the given buffer into _effectBuffer.
          * Assumes that srcBuffer is the same format as _format.
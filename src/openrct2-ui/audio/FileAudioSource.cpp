@@ -16,7 +16,13 @@
 
 #include <openrct2/common.h>
 #include <SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <openrct2/core/Math.hpp>
+#include <openrct2/core/Memory.hpp>
 #include <openrct2/audio/AudioSource.h>
 #include "AudioContext.h"
 #include "AudioFormat.h"
@@ -25,16 +31,43 @@ namespace OpenRCT2 { namespace Audio
 {
     /**
      * An audio source where raw PCM data is streamed directly from
-     * a file.
+     * a file. A background thread reads ahead into a ring buffer so that
+     * the audio callback never has to wait on file I/O.
      */
     class FileAudioSource final : public ISDLAudioSource
     {
     private:
+        static constexpr size_t RING_BUFFER_SIZE = 256 * 1024;
+        static constexpr size_t READ_CHUNK_SIZE = 16 * 1024;
+
         AudioFormat _format = { 0 };
         SDL_RWops * _rw = nullptr;
         uint64      _dataBegin = 0;
         uint64      _dataLength = 0;
 
+        std::vector<uint8>  _ringBuffer;
+        std::thread         _readThread;
+        std::atomic<bool>   _stopReading { false };
+
+        // Wakes the reader thread when space is freed, a seek is requested or reading stops
+        std::mutex              _readMutex;
+        std::condition_variable _readCondition;
+
+        // Written by the reader thread, read by the audio callback
+        std::atomic<size_t> _writePosition { 0 };
+        std::atomic<uint32> _bufferedGeneration { 0 };
+        std::atomic<size_t> _bufferedGenerationStart { 0 };
+
+        // Written by the audio callback, read by the reader thread
+        std::atomic<size_t> _readPosition { 0 };
+        std::atomic<uint32> _requestedGeneration { 0 };
+        std::atomic<uint64> _requestedOffset { 0 };
+
+        // Only used by the audio callback
+        uint64 _readOffset = 0;
+        uint32 _generation = 0;
+        uint32 _readGeneration = 0;
+
     public:
         ~FileAudioSource()
         {
@@ -53,23 +86,45 @@ namespace OpenRCT2 { namespace Audio
 
         size_t Read(void * dst, uint64 offset, size_t len) override
         {
-            size_t bytesRead = 0;
-            sint64 currentPosition = SDL_RWtell(_rw);
-            if (currentPosition != -1)
+            if (offset != _readOffset)
             {
-                size_t bytesToRead = (size_t)Math::Min<uint64>(len, _dataLength - offset);
-                sint64 dataOffset = _dataBegin + offset;
-                if (currentPosition != dataOffset)
-                {
-                    sint64 newPosition = SDL_RWseek(_rw, dataOffset, SEEK_SET);
-                    if (newPosition == -1)
-                    {
-                        return 0;
-                    }
-                }
-                bytesRead = SDL_RWread(_rw, dst, 1, bytesToRead);
+                // Ask the reader thread to refill from the new position
+                _readOffset = offset;
+                _generation++;
+                _requestedOffset.store(offset, std::memory_order_relaxed);
+                _requestedGeneration.store(_generation, std::memory_order_release);
+                NotifyReader();
+            }
+            if (_bufferedGeneration.load(std::memory_order_acquire) != _generation)
+            {
+                // Still seeking, the channel will output silence for now
+                return 0;
+            }
+
+            size_t readPosition = _readPosition.load(std::memory_order_relaxed);
+            if (_readGeneration != _generation)
+            {
+                // Skip any data that was buffered before the seek
+                readPosition = _bufferedGenerationStart.load(std::memory_order_relaxed);
+                _readGeneration = _generation;
+            }
+
+            size_t available = _writePosition.load(std::memory_order_acquire) - readPosition;
+            size_t bytesToRead = (size_t)Math::Min<uint64>(Math::Min(len, available), _dataLength - offset);
+            CopyFromRingBuffer(dst, readPosition, bytesToRead);
+            _readPosition.store(readPosition + bytesToRead, std::memory_order_release);
+            if (bytesToRead != 0)
+            {
+                NotifyReader();
+            }
+
+            // The reader thread wraps around at the end of the data, matching looped channels
+            _readOffset += bytesToRead;
+            if (_readOffset >= _dataLength)
+            {
+                _readOffset = 0;
             }
-            return bytesRead;
+            return bytesToRead;
         }
 
         bool LoadWAV(SDL_RWops * rw)
@@ -145,10 +200,111 @@ namespace OpenRCT2 { namespace Audio
 
             _dataLength = dataChunkSize;
             _dataBegin = SDL_RWtell(rw);
+
+            _ringBuffer.resize(RING_BUFFER_SIZE);
+            _stopReading = false;
+            _readThread = std::thread([this]() -> void { ReadAhead(); });
             return true;
         }
 
     private:
+        void ReadAhead()
+        {
+            std::vector<uint8> chunk(READ_CHUNK_SIZE);
+            uint32 generation = 0;
+            uint64 fileOffset = 0;
+            bool mustSeek = true;
+            while (!_stopReading)
+            {
+                uint32 requestedGeneration = _requestedGeneration.load(std::memory_order_acquire);
+                if (requestedGeneration != generation)
+                {
+                    generation = requestedGeneration;
+                    fileOffset = _requestedOffset.load(std::memory_order_relaxed);
+                    mustSeek = true;
+                    _bufferedGenerationStart.store(_writePosition.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    _bufferedGeneration.store(generation, std::memory_order_release);
+                }
+
+                size_t writePosition = _writePosition.load(std::memory_order_relaxed);
+                if (GetFreeSpace(writePosition) < READ_CHUNK_SIZE)
+                {
+                    WaitForRequest(generation, true);
+                    continue;
+                }
+
+                if (mustSeek)
+                {
+                    SDL_RWseek(_rw, _dataBegin + fileOffset, RW_SEEK_SET);
+                    mustSeek = false;
+                }
+                size_t bytesToRead = (size_t)Math::Min<uint64>(READ_CHUNK_SIZE, _dataLength - fileOffset);
+                size_t bytesRead = SDL_RWread(_rw, chunk.data(), 1, bytesToRead);
+                if (bytesRead == 0)
+                {
+                    // Reading again from the same place would fail again, wait for a seek instead
+                    WaitForRequest(generation, false);
+                    mustSeek = true;
+                    continue;
+                }
+
+                CopyToRingBuffer(writePosition, chunk.data(), bytesRead);
+                _writePosition.store(writePosition + bytesRead, std::memory_order_release);
+
+                fileOffset += bytesRead;
+                if (fileOffset >= _dataLength)
+                {
+                    fileOffset = 0;
+                    mustSeek = true;
+                }
+            }
+        }
+
+        size_t GetFreeSpace(size_t writePosition) const
+        {
+            return RING_BUFFER_SIZE - (writePosition - _readPosition.load(std::memory_order_acquire));
+        }
+
+        /**
+         * Blocks the reader thread until a seek other than the given generation is requested, reading stops or,
+         * if waitForSpace is set, there is space in the ring buffer for another chunk.
+         */
+        void WaitForRequest(uint32 generation, bool waitForSpace)
+        {
+            std::unique_lock<std::mutex> lock(_readMutex);
+            _readCondition.wait(lock, [this, generation, waitForSpace]() -> bool
+            {
+                return _stopReading ||
+                    _requestedGeneration.load(std::memory_order_acquire) != generation ||
+                    (waitForSpace && GetFreeSpace(_writePosition.load(std::memory_order_relaxed)) >= READ_CHUNK_SIZE);
+            });
+        }
+
+        void NotifyReader()
+        {
+            // Taking the lock orders the change before the reader's next check, so the wake up cannot be missed
+            {
+                std::lock_guard<std::mutex> lock(_readMutex);
+            }
+            _readCondition.notify_one();
+        }
+
+        void CopyToRingBuffer(size_t position, const uint8 * src, size_t len)
+        {
+            size_t index = position % RING_BUFFER_SIZE;
+            size_t firstLen = Math::Min(len, RING_BUFFER_SIZE - index);
+            Memory::Copy(_ringBuffer.data() + index, src, firstLen);
+            Memory::Copy(_ringBuffer.data(), src + firstLen, len - firstLen);
+        }
+
+        void CopyFromRingBuffer(void * dst, size_t position, size_t len)
+        {
+            size_t index = position % RING_BUFFER_SIZE;
+            size_t firstLen = Math::Min(len, RING_BUFFER_SIZE - index);
+            Memory::Copy((uint8 *)dst, _ringBuffer.data() + index, firstLen);
+            Memory::Copy((uint8 *)dst + firstLen, _ringBuffer.data(), len - firstLen);
+        }
+
         uint32 FindChunk(SDL_RWops * rw, uint32 wantedId)
         {
             uint32 subchunkId = SDL_ReadLE32(rw);
@@ -176,6 +332,12 @@ namespace OpenRCT2 { namespace Audio
 
         void Unload()
         {
+            if (_readThread.joinable())
+            {
+                _stopReading = true;
+                NotifyReader();
+                _readThread.join();
+            }
             if (_rw != nullptr)
             {
                 SDL_RWclose(_rw);
@@ -151,7 +151,12 @@ namespace OpenRCT2 { namespace Audio
 
         bool Convert(const AudioFormat * format)
         {
-            if (*format != _format)
+            if (*format == _format)
+            {
+                // Already in the target format, nothing to do
+                return true;
+            }
+            else
             {
                 SDL_AudioCVT cvt;
                 if (SDL_BuildAudioCVT(&cvt, _format.format, _format.channels, _format.freq, format->format, format->channels, format->freq) >= 0)
@@ -14,6 +14,7 @@
 *****************************************************************************/
 #pragma endregion
 
+#include <algorithm>
 #include <exception>
 #include <memory>
 #include <string>
@@ -33,6 +34,7 @@
 #include "ParkImporter.h"
 #include "platform/crash.h"
 #include "PlatformEnvironment.h"
+#include "Replay.h"
 #include "ride/TrackDesignRepository.h"
 #include "scenario/ScenarioRepository.h"
 #include "title/TitleScreen.h"
@@ -83,6 +85,11 @@ namespace OpenRCT2
         uint32 _lastTick = 0;
         uint32 _uncapTick = 0;
 
+        // Upper bound on the ticks run between servicing the network, so clients are not starved
+        constexpr static uint32 FAST_FORWARD_MAX_TICKS_PER_FRAME = 256;
+        uint32 _fastForwardStartTick = 0;
+        uint64 _fastForwardTicks = 0;
+
         /** If set, will end the OpenRCT2 game loop. Intentially private to this module so that the flag can not be set back to false. */
         bool _finished = false;
 
@@ -385,6 +392,9 @@ namespace OpenRCT2
                     title_load();
                 }
                 break;
+            case STARTUP_ACTION_REPLAY:
+                gExitCode = replay_run(gOpenRCT2StartupActionPath) ? 0 : 1;
+                return;
             }
 
 #ifndef DISABLE_NETWORK
@@ -410,7 +420,11 @@ namespace OpenRCT2
             _finished = false;
             do
             {
-                if (ShouldRunVariableFrame())
+                if (ShouldRunFastForwardFrame())
+                {
+                    RunFastForwardFrame();
+                }
+                else if (ShouldRunVariableFrame())
                 {
                     RunVariableFrame();
                 }
@@ -431,6 +445,55 @@ namespace OpenRCT2
             return true;
         }
 
+        bool ShouldRunFastForwardFrame()
+        {
+            if (!gOpenRCT2Headless) return false;
+            if (!gOpenRCT2FastForward) return false;
+            if (gIntroState != INTRO_STATE_NONE) return false;
+            if (gScreenFlags & SCREEN_FLAGS_TITLE_DEMO) return false;
+            // A client can not get ahead of the server
+            if (network_get_mode() == NETWORK_MODE_CLIENT) return false;
+            return true;
+        }
+
+        void RunFastForwardFrame()
+        {
+            uint32 currentTick = platform_get_ticks();
+            uint32 numUpdates = FAST_FORWARD_MAX_TICKS_PER_FRAME;
+            uint32 ticksPerSecond = gOpenRCT2FastForwardTicksPerSecond;
+            if (game_is_paused())
+            {
+                _fastForwardTicks = 0;
+                numUpdates = 0;
+            }
+            else if (ticksPerSecond != 0)
+            {
+                if (_fastForwardTicks == 0)
+                {
+                    _fastForwardStartTick = currentTick;
+                }
+
+                uint64 ticksDue = ((uint64)(currentTick - _fastForwardStartTick) * ticksPerSecond) / 1000 + 1;
+                uint64 ticksBehind = ticksDue > _fastForwardTicks ? ticksDue - _fastForwardTicks : 0;
+                numUpdates = (uint32)std::min<uint64>(ticksBehind, FAST_FORWARD_MAX_TICKS_PER_FRAME);
+                _fastForwardTicks += numUpdates;
+
+                // Drop the ticks that could not be run in time rather than trying to catch up later
+                if (ticksBehind > FAST_FORWARD_MAX_TICKS_PER_FRAME)
+                {
+                    _fastForwardTicks = ticksDue;
+                }
+            }
+
+            GetContext()->GetUiContext()->ProcessMessages();
+            game_update_headless(numUpdates);
+
+            if (numUpdates == 0)
+            {
+                platform_sleep(1);
+            }
+        }
+
         void RunFixedFrame()
         {
             _uncapTick = 0;
@@ -127,6 +127,124 @@ namespace Imaging
         }
     }
 
+    /**
+     * Reads a PNG as one byte per pixel, the average of the red, green and blue channels. Rows are
+     * converted as they are decoded, so the full RGBA image is never held in memory.
+     */
+    bool PngReadMono(uint8 * * pixels, uint32 * width, uint32 * height, const utf8 * path)
+    {
+        png_structp png_ptr;
+        png_infop info_ptr;
+
+        // Setup PNG structures
+        png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+        if (png_ptr == nullptr)
+        {
+            return false;
+        }
+
+        info_ptr = png_create_info_struct(png_ptr);
+        if (info_ptr == nullptr)
+        {
+            png_destroy_read_struct(&png_ptr, nullptr, nullptr);
+            return false;
+        }
+
+        // Open PNG file, the buffers are assigned after setjmp so must be volatile to be freed after a longjmp
+        uint8 * volatile monoPixels = nullptr;
+        uint8 * volatile rowBuffer = nullptr;
+        png_bytep * volatile rowPointers = nullptr;
+        try
+        {
+            auto fs = FileStream(path, FILE_MODE_OPEN);
+
+            // Set error handling
+            if (setjmp(png_jmpbuf(png_ptr)))
+            {
+                png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
+                Memory::Free(monoPixels);
+                Memory::Free(rowBuffer);
+                Memory::Free(rowPointers);
+                return false;
+            }
+
+            // Setup PNG reading
+            png_set_read_fn(png_ptr, &fs, PngReadData);
+            png_read_info(png_ptr, info_ptr);
+
+            // Use the same transforms as PngRead, so every image ends up as 24-bit RGB rows
+            png_set_strip_16(png_ptr);
+            png_set_packing(png_ptr);
+            png_set_expand(png_ptr);
+            png_set_gray_to_rgb(png_ptr);
+            png_set_strip_alpha(png_ptr);
+            sint32 numPasses = png_set_interlace_handling(png_ptr);
+            png_read_update_info(png_ptr, info_ptr);
+
+            png_uint_32 pngWidth = png_get_image_width(png_ptr, info_ptr);
+            png_uint_32 pngHeight = png_get_image_height(png_ptr, info_ptr);
+            png_size_t rowBytes = png_get_rowbytes(png_ptr, info_ptr);
+            Guard::Assert(rowBytes == pngWidth * 3, GUARD_LINE);
+
+            monoPixels = Memory::Allocate<uint8>(pngWidth * pngHeight);
+            if (numPasses == 1)
+            {
+                rowBuffer = Memory::Allocate<uint8>(rowBytes);
+                for (png_uint_32 y = 0; y < pngHeight; y++)
+                {
+                    png_read_row(png_ptr, rowBuffer, nullptr);
+                    const uint8 * src = rowBuffer;
+                    uint8 * dst = &monoPixels[y * pngWidth];
+                    for (png_uint_32 x = 0; x < pngWidth; x++, src += 3)
+                    {
+                        dst[x] = (src[0] + src[1] + src[2]) / 3;
+                    }
+                }
+            }
+            else
+            {
+                // Interlaced rows are only complete after the last pass, so decode the whole image first
+                rowBuffer = Memory::Allocate<uint8>(rowBytes * pngHeight);
+                rowPointers = Memory::AllocateArray<png_bytep>(pngHeight);
+                for (png_uint_32 y = 0; y < pngHeight; y++)
+                {
+                    rowPointers[y] = &rowBuffer[y * rowBytes];
+                }
+                png_read_image(png_ptr, rowPointers);
+                Memory::Free(rowPointers);
+                rowPointers = nullptr;
+
+                const uint8 * src = rowBuffer;
+                for (png_uint_32 i = 0; i < pngWidth * pngHeight; i++, src += 3)
+                {
+                    monoPixels[i] = (src[0] + src[1] + src[2]) / 3;
+                }
+            }
+            Memory::Free(rowBuffer);
+
+            // Close the PNG
+            png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
+
+            // Return the output data
+            *pixels = monoPixels;
+            if (width != nullptr) *width = pngWidth;
+            if (height != nullptr) *height = pngHeight;
+
+            return true;
+        }
+        catch (Exception)
+        {
+            png_destroy_read_struct(&png_ptr, &info_ptr, nullptr);
+            Memory::Free(monoPixels);
+            Memory::Free(rowBuffer);
+            Memory::Free(rowPointers);
+            *pixels = nullptr;
+            if (width != nullptr) *width = 0;
+            if (height != nullptr) *height = 0;
+            return false;
+        }
+    }
+
     bool PngWrite(const rct_drawpixelinfo * dpi, const rct_palette * palette, const utf8 * path)
     {
         bool result = false;
@@ -292,6 +410,11 @@ extern "C"
         return Imaging::PngRead(pixels, width, height, path);
     }
 
+    bool image_io_png_read_mono(uint8 * * pixels, uint32 * width, uint32 * height, const utf8 * path)
+    {
+        return Imaging::PngReadMono(pixels, width, height, path);
+    }
+
     bool image_io_png_write(const rct_drawpixelinfo * dpi, const rct_palette * palette, const utf8 * path)
     {
         return Imaging::PngWrite(dpi, palette, path);
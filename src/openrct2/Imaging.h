@@ -24,6 +24,7 @@
 namespace Imaging
 {
     bool PngRead(uint8 * * pixels, uint32 * width, uint32 * height, const utf8 * path);
+    bool PngReadMono(uint8 * * pixels, uint32 * width, uint32 * height, const utf8 * path);
     bool PngWrite(const rct_drawpixelinfo * dpi, const rct_palette * palette, const utf8 * path);
     bool PngWrite32bpp(sint32 width, sint32 height, const void * pixels, const utf8 * path);
 }
@@ -35,6 +36,7 @@ extern "C"
 {
 #endif
     bool image_io_png_read(uint8 * * pixels, uint32 * width, uint32 * height, const utf8 * path);
+    bool image_io_png_read_mono(uint8 * * pixels, uint32 * width, uint32 * height, const utf8 * path);
     bool image_io_png_write(const rct_drawpixelinfo * dpi, const rct_palette * palette, const utf8 * path);
     bool image_io_png_write_32bpp(sint32 width, sint32 height, const void * pixels, const utf8 * path);
 #ifdef __cplusplus
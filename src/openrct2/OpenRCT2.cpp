@@ -37,9 +37,19 @@ extern "C"
     utf8 gCustomRCT2DataPath[MAX_PATH] = { 0 };
     utf8 gCustomPassword[MAX_PATH] = { 0 };
 
+    // A replay is recorded to this path each time a park is loaded
+    utf8 gReplayRecordPath[MAX_PATH] = { 0 };
+
     // This should probably be changed later and allow a custom selection of things to initialise like SDL_INIT
     bool gOpenRCT2Headless = false;
 
+    // Dedicated servers never draw, so sprite data, fonts and object images are not loaded
+    bool gOpenRCT2NoGraphics = false;
+
+    // Headless only, runs the simulation at the given rate (0 for as fast as possible) instead of in real time
+    bool gOpenRCT2FastForward = false;
+    uint32 gOpenRCT2FastForwardTicksPerSecond = 0;
+
     bool gOpenRCT2ShowChangelog;
     bool gOpenRCT2SilentBreakpad;
 
@@ -38,7 +38,8 @@ enum STARTUP_ACTION
     STARTUP_ACTION_INTRO,
     STARTUP_ACTION_TITLE,
     STARTUP_ACTION_OPEN,
-    STARTUP_ACTION_EDIT
+    STARTUP_ACTION_EDIT,
+    STARTUP_ACTION_REPLAY
 };
 
 #ifdef __cplusplus
@@ -56,7 +57,11 @@ extern "C"
     extern utf8 gCustomOpenrctDataPath[MAX_PATH];
     extern utf8 gCustomRCT2DataPath[MAX_PATH];
     extern utf8 gCustomPassword[MAX_PATH];
+    extern utf8 gReplayRecordPath[MAX_PATH];
     extern bool gOpenRCT2Headless;
+    extern bool gOpenRCT2NoGraphics;
+    extern bool gOpenRCT2FastForward;
+    extern uint32 gOpenRCT2FastForwardTicksPerSecond;
     extern bool gOpenRCT2ShowChangelog;
 
 #ifndef DISABLE_NETWORK
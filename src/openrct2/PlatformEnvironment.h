@@ -53,6 +53,7 @@ enum class PATHID
     CONFIG_KEYBOARD,    // Keyboard shortcuts. (hotkeys.cfg)
     CACHE_OBJECTS,      // Object repository cache (objects.idx).
     CACHE_TRACKS,       // Track repository cache (tracks.idx).
+    CACHE_TRACK_PREVIEWS, // Track design preview image cache (trackpreviews.dat).
     NETWORK_GROUPS,     // Server groups with permissions (groups.json).
     NETWORK_SERVERS,    // Saved servers (servers.cfg).
     NETWORK_USERS,      // Users and their groups (users.json).
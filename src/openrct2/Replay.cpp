@@ -0,0 +1,303 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include <memory>
+#include <string>
+#include "core/Console.hpp"
+#include "core/Exception.hpp"
+#include "core/FileStream.hpp"
+#include "core/Math.hpp"
+#include "core/MemoryStream.h"
+#include "core/String.hpp"
+#include "network/network.h"
+#include "object/ObjectManager.h"
+#include "OpenRCT2.h"
+#include "Replay.h"
+
+extern "C"
+{
+    #include "game.h"
+    #include "scenario/scenario.h"
+    #include "world/sprite.h"
+}
+
+#ifndef DISABLE_NETWORK
+
+#pragma pack(push, 1)
+struct ReplayHeader
+{
+    uint32  MagicNumber;
+    uint16  Version;
+    uint32  StartTick;
+    uint32  ParkLength;
+};
+
+struct ReplayCommand
+{
+    uint32  Tick;
+    uint32  Srand0;
+    sint32  Command;
+    sint32  Args[6]; // eax, ebx, ecx, edx, edi, ebp
+    uint8   PlayerId;
+};
+#pragma pack(pop)
+
+constexpr uint32 REPLAY_MAGIC_NUMBER = 0x59504C52;
+constexpr uint16 REPLAY_VERSION = 1;
+// Number of ticks between sprite checksums, which take too long to record every tick
+constexpr uint32 REPLAY_CHECKPOINT_INTERVAL = 32;
+
+enum REPLAY_RECORD
+{
+    REPLAY_RECORD_COMMAND,
+    REPLAY_RECORD_CHECKPOINT,
+};
+
+static std::unique_ptr<FileStream> _replayStream;
+// Set while a replay is played back, so loading its park does not start a new recording
+static bool _replayPlaying = false;
+
+/**
+ * Writes a snapshot of the current park, including the state that is only sent to network clients,
+ * and records every top-level game command and a sprite checksum every few ticks after it.
+ */
+bool replay_start_recording(const utf8 * path)
+{
+    replay_stop_recording();
+    try
+    {
+        auto ms = MemoryStream();
+        IObjectManager * objectManager = GetObjectManager();
+        if (!Network::SaveMap(&ms, objectManager->GetPackableObjects()))
+        {
+            throw Exception("Unable to export park.");
+        }
+
+        auto fs = std::unique_ptr<FileStream>(new FileStream(path, FILE_MODE_WRITE));
+        ReplayHeader header = { 0 };
+        header.MagicNumber = REPLAY_MAGIC_NUMBER;
+        header.Version = REPLAY_VERSION;
+        header.StartTick = gCurrentTicks;
+        header.ParkLength = (uint32)ms.GetLength();
+        fs->WriteValue(header);
+        fs->Write(ms.GetData(), ms.GetLength());
+        _replayStream = std::move(fs);
+
+        log_verbose("Recording replay to '%s' from tick %u", path, gCurrentTicks);
+        return true;
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to record replay to '%s'.", path);
+        return false;
+    }
+}
+
+void replay_stop_recording()
+{
+    _replayStream = nullptr;
+}
+
+bool replay_is_recording()
+{
+    return _replayStream != nullptr;
+}
+
+void replay_park_loaded()
+{
+    if (!_replayPlaying && !String::IsNullOrEmpty(gReplayRecordPath))
+    {
+        replay_start_recording(gReplayRecordPath);
+    }
+}
+
+void replay_record_command(sint32 command, sint32 eax, sint32 ebx, sint32 ecx, sint32 edx, sint32 edi, sint32 ebp, uint8 playerId)
+{
+    if (_replayStream == nullptr)
+    {
+        return;
+    }
+
+    ReplayCommand record;
+    record.Tick = gCurrentTicks;
+    record.Srand0 = gScenarioSrand0;
+    record.Command = command;
+    record.Args[0] = eax;
+    record.Args[1] = ebx;
+    record.Args[2] = ecx;
+    record.Args[3] = edx;
+    record.Args[4] = edi;
+    record.Args[5] = ebp;
+    record.PlayerId = playerId;
+    try
+    {
+        _replayStream->WriteValue<uint8>(REPLAY_RECORD_COMMAND);
+        _replayStream->WriteValue(record);
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to write replay, recording stopped.");
+        replay_stop_recording();
+    }
+}
+
+void replay_record_tick()
+{
+    if (_replayStream == nullptr || (gCurrentTicks % REPLAY_CHECKPOINT_INTERVAL) != 0)
+    {
+        return;
+    }
+
+    try
+    {
+        _replayStream->WriteValue<uint8>(REPLAY_RECORD_CHECKPOINT);
+        _replayStream->WriteValue<uint32>(gCurrentTicks);
+        _replayStream->WriteValue<uint32>(gScenarioSrand0);
+        _replayStream->WriteString(sprite_checksum());
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to write replay, recording stopped.");
+        replay_stop_recording();
+    }
+}
+
+static bool replay_play(const utf8 * path)
+{
+    std::unique_ptr<FileStream> fs;
+    try
+    {
+        fs = std::unique_ptr<FileStream>(new FileStream(path, FILE_MODE_OPEN));
+        auto header = fs->ReadValue<ReplayHeader>();
+        if (header.MagicNumber != REPLAY_MAGIC_NUMBER || header.Version != REPLAY_VERSION)
+        {
+            Console::Error::WriteLine("'%s' is not a replay.", path);
+            return false;
+        }
+
+        void * parkData = fs->ReadArray<uint8>(header.ParkLength);
+        auto ms = MemoryStream(parkData, header.ParkLength, MEMORY_ACCESS::READ | MEMORY_ACCESS::OWNER);
+        if (!Network::LoadMap(&ms))
+        {
+            Console::Error::WriteLine("Unable to load the park of '%s'.", path);
+            return false;
+        }
+        game_load_init();
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to read '%s'.", path);
+        return false;
+    }
+
+    uint32 numCommands = 0;
+    uint32 numCheckpoints = 0;
+    uint32 numDesyncs = 0;
+    uint32 numCheckpointsFailed = 0;
+    uint32 startTick = gCurrentTicks;
+    uint32 startTime = platform_get_ticks();
+    try
+    {
+        uint8 recordType;
+        while (fs->TryRead(&recordType, sizeof(recordType)) == sizeof(recordType))
+        {
+            uint32 tick;
+            if (recordType == REPLAY_RECORD_COMMAND)
+            {
+                auto record = fs->ReadValue<ReplayCommand>();
+                tick = record.Tick;
+                while (gCurrentTicks < tick)
+                {
+                    game_logic_update();
+                }
+                if (record.Srand0 != gScenarioSrand0)
+                {
+                    Console::Error::WriteLine("Desync before command %d at tick %u.", record.Command, tick);
+                    numDesyncs++;
+                }
+
+                game_command_playerid = record.PlayerId;
+                game_do_command_p(record.Command, &record.Args[0], &record.Args[1], &record.Args[2], &record.Args[3],
+                                  &record.Command, &record.Args[4], &record.Args[5]);
+                numCommands++;
+            }
+            else if (recordType == REPLAY_RECORD_CHECKPOINT)
+            {
+                tick = fs->ReadValue<uint32>();
+                uint32 srand0 = fs->ReadValue<uint32>();
+                std::string checksum = fs->ReadStdString();
+                while (gCurrentTicks < tick)
+                {
+                    game_logic_update();
+                }
+                if (srand0 != gScenarioSrand0 || checksum != sprite_checksum())
+                {
+                    Console::Error::WriteLine("Desync at tick %u.", tick);
+                    numDesyncs++;
+                    numCheckpointsFailed++;
+                }
+                numCheckpoints++;
+            }
+            else
+            {
+                throw IOException("Invalid record.");
+            }
+
+            if (tick < gCurrentTicks)
+            {
+                throw IOException("Records out of order.");
+            }
+        }
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("'%s' is corrupt, stopped at tick %u.", path, gCurrentTicks);
+        return false;
+    }
+
+    uint32 elapsed = Math::Max<uint32>(1, platform_get_ticks() - startTime);
+    uint32 numTicks = gCurrentTicks - startTick;
+    Console::WriteLine("Replayed %u ticks and %u commands in %u ms (%u ticks per second).",
+                       numTicks, numCommands, elapsed, (uint32)((uint64)numTicks * 1000 / elapsed));
+    Console::WriteLine("%u of %u checkpoints matched.", numCheckpoints - numCheckpointsFailed, numCheckpoints);
+    return numDesyncs == 0;
+}
+
+bool replay_run(const utf8 * path)
+{
+    replay_stop_recording();
+    _replayPlaying = true;
+    bool result = replay_play(path);
+    _replayPlaying = false;
+    return result;
+}
+
+#else
+
+bool replay_start_recording(const utf8 * path) { return false; }
+void replay_stop_recording() { }
+bool replay_is_recording() { return false; }
+void replay_park_loaded() { }
+void replay_record_command(sint32 command, sint32 eax, sint32 ebx, sint32 ecx, sint32 edx, sint32 edi, sint32 ebp, uint8 playerId) { }
+void replay_record_tick() { }
+
+bool replay_run(const utf8 * path)
+{
+    Console::Error::WriteLine("Replays require a build with multiplayer enabled.");
+    return false;
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,39 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#pragma once
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    bool replay_start_recording(const utf8 * path);
+    void replay_stop_recording();
+    bool replay_is_recording();
+    void replay_park_loaded();
+    void replay_record_command(sint32 command, sint32 eax, sint32 ebx, sint32 ecx, sint32 edx, sint32 edi, sint32 ebp, uint8 playerId);
+    void replay_record_tick();
+
+    /**
+     * Replays a recorded session as fast as possible, verifying the sprite checksums stored in it.
+     * @return true if the replay finished without a desync.
+     */
+    bool replay_run(const utf8 * path);
+#ifdef __cplusplus
+}
+#endif
@@ -57,7 +57,10 @@ static bool   _all             = false;
 static bool   _about           = false;
 static bool   _verbose         = false;
 static bool   _headless        = false;
+static bool   _fastForward     = false;
+static uint32 _ticksPerSecond  = 0;
 static utf8 * _password        = nullptr;
+static utf8 * _recordPath      = nullptr;
 static utf8 * _userDataPath    = nullptr;
 static utf8 * _openrctDataPath = nullptr;
 static utf8 * _rct2DataPath    = nullptr;
@@ -72,11 +75,16 @@ static const CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_SWITCH,  &_about,           NAC, "about",             "show information about " OPENRCT2_NAME                      },
     { CMDLINE_TYPE_SWITCH,  &_verbose,         NAC, "verbose",           "log verbose messages"                                       },
     { CMDLINE_TYPE_SWITCH,  &_headless,        NAC, "headless",          "run " OPENRCT2_NAME " headless" IMPLIES_SILENT_BREAKPAD     },
+    { CMDLINE_TYPE_SWITCH,  &_fastForward,     NAC, "fast-forward",      "run the simulation as fast as possible when headless"       },
+    { CMDLINE_TYPE_INTEGER, &_ticksPerSecond,  NAC, "ticks-per-second",  "limit the fast-forward simulation rate (40 is real time)"   },
 #ifndef DISABLE_NETWORK
     { CMDLINE_TYPE_INTEGER, &_port,            NAC, "port",              "port to use for hosting or joining a server"                },
     { CMDLINE_TYPE_STRING,  &_address,         NAC, "address",           "address to listen on when hosting a server"                 },
 #endif
     { CMDLINE_TYPE_STRING,  &_password,        NAC, "password",          "password needed to join the server"                         },
+#ifndef DISABLE_NETWORK
+    { CMDLINE_TYPE_STRING,  &_recordPath,      NAC, "record",            "record a replay of the session to the given file"           },
+#endif
     { CMDLINE_TYPE_STRING,  &_userDataPath,    NAC, "user-data-path",    "path to the user data directory (containing config.ini)"    },
     { CMDLINE_TYPE_STRING,  &_openrctDataPath, NAC, "openrct-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,    NAC, "rct2-data-path",    "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
@@ -91,6 +99,7 @@ static exitcode_t HandleCommandEdit(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandIntro(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandHost(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandReplay(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandScanObjects(CommandLineArgEnumerator * enumerator);
 
@@ -125,6 +134,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #ifndef DISABLE_NETWORK
     DefineCommand("host",     "<uri>",                  StandardOptions, HandleCommandHost   ),
     DefineCommand("join",     "<hostname>",             StandardOptions, HandleCommandJoin   ),
+    DefineCommand("replay",   "<path>",                 StandardOptions, HandleCommandReplay ),
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
@@ -152,6 +162,7 @@ const CommandLineExample CommandLine::RootExamples[]
 #endif
 #ifndef DISABLE_NETWORK
     { "host ./my_park.sv6 --port 11753 --headless",   "run a headless server for a saved park" },
+    { "replay ./session.rpl",                         "replay a recorded session and check it" },
 #endif
     ExampleTableEnd
 };
@@ -189,8 +200,17 @@ exitcode_t CommandLine::HandleCommandDefault()
     }
 
     gOpenRCT2Headless = _headless;
+    gOpenRCT2NoGraphics = _headless;
     gOpenRCT2SilentBreakpad = _silentBreakpad || _headless;
 
+    gOpenRCT2FastForward = _fastForward || _ticksPerSecond != 0;
+    gOpenRCT2FastForwardTicksPerSecond = _ticksPerSecond;
+    if (gOpenRCT2FastForward && !_headless && result == EXITCODE_CONTINUE)
+    {
+        Console::Error::WriteLine("Fast-forward is only available with --headless.");
+        result = EXITCODE_FAIL;
+    }
+
     if (_userDataPath != nullptr)
     {
         String::Set(gCustomUserDataPath, sizeof(gCustomUserDataPath), _userDataPath);
@@ -215,6 +235,12 @@ exitcode_t CommandLine::HandleCommandDefault()
         Memory::Free(_password);
     }
 
+    if (_recordPath != nullptr)
+    {
+        String::Set(gReplayRecordPath, sizeof(gReplayRecordPath), _recordPath);
+        Memory::Free(_recordPath);
+    }
+
     return result;
 }
 
@@ -316,6 +342,30 @@ exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator)
     return EXITCODE_CONTINUE;
 }
 
+exitcode_t HandleCommandReplay(CommandLineArgEnumerator * enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const char * replayPath;
+    if (!enumerator->TryPopString(&replayPath))
+    {
+        Console::Error::WriteLine("Expected path to a recorded replay.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2StartupAction = STARTUP_ACTION_REPLAY;
+    String::Set(gOpenRCT2StartupActionPath, sizeof(gOpenRCT2StartupActionPath), replayPath);
+
+    // Replays are verified without any user interface
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    return EXITCODE_CONTINUE;
+}
+
 #endif // DISABLE_NETWORK
 
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator)
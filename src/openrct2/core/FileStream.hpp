@@ -31,6 +31,7 @@ enum
     FILE_MODE_OPEN,
     FILE_MODE_WRITE,
     FILE_MODE_APPEND,
+    FILE_MODE_UPDATE,
 };
 
 /**
@@ -71,6 +72,11 @@ public:
             _canRead = false;
             _canWrite = true;
             break;
+        case FILE_MODE_UPDATE:
+            mode = "r+b";
+            _canRead = true;
+            _canWrite = true;
+            break;
         default:
             throw;
         }
@@ -50,6 +50,14 @@ namespace Memory
         return result;
     }
 
+    template<typename T>
+    static T * AllocateArrayZeroed(size_t count)
+    {
+        T* result = (T*)calloc(count, sizeof(T));
+        Guard::ArgumentNotNull(result, "Failed to allocate array of %u * %s (%u bytes)", count, typeid(T).name(), sizeof(T));
+        return result;
+    }
+
     template<typename T>
     static T * Reallocate(T * ptr, size_t size)
     {
@@ -0,0 +1,120 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include "../common.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    extern "C" {
+        // Windows needs this for widechar <-> utf8 conversion utils
+        #include "../localisation/language.h"
+    }
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::string &path)
+{
+    wchar_t * pathW = utf8_to_widechar(path.c_str());
+    HANDLE hFile = CreateFileW(pathW, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    free(pathW);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize) || (uint64)fileSize.QuadPart > SIZE_MAX)
+    {
+        CloseHandle(hFile);
+        throw IOException(String::StdFormat("Unable to get size of '%s'", path.c_str()));
+    }
+
+    HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (hMapping == nullptr)
+    {
+        CloseHandle(hFile);
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+
+    void * data = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        CloseHandle(hMapping);
+        CloseHandle(hFile);
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+
+    _file = hFile;
+    _mapping = hMapping;
+    _data = data;
+    _length = (size_t)fileSize.QuadPart;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    UnmapViewOfFile(_data);
+    CloseHandle((HANDLE)_mapping);
+    CloseHandle((HANDLE)_file);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string &path)
+{
+    sint32 fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+
+    struct stat statInfo;
+    if (fstat(fd, &statInfo) != 0 || statInfo.st_size <= 0 || (uint64)statInfo.st_size > SIZE_MAX)
+    {
+        close(fd);
+        throw IOException(String::StdFormat("Unable to get size of '%s'", path.c_str()));
+    }
+
+    size_t length = (size_t)statInfo.st_size;
+    void * data = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+
+    _data = data;
+    _length = length;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    munmap(_data, _length);
+}
+
+#endif
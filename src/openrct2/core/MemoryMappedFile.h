@@ -0,0 +1,45 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#pragma once
+
+#include <string>
+#include "../common.h"
+
+/**
+ * A read-only view of an entire file mapped into the address space. Pages are
+ * loaded on demand by the OS and shared between processes mapping the same file.
+ */
+class MemoryMappedFile final
+{
+private:
+    void *      _data   = nullptr;
+    size_t      _length = 0;
+#ifdef _WIN32
+    void *      _file   = nullptr;
+    void *      _mapping = nullptr;
+#endif
+
+public:
+    explicit MemoryMappedFile(const std::string &path);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile &) = delete;
+    MemoryMappedFile & operator=(const MemoryMappedFile &) = delete;
+
+    const void * GetData() const { return _data; }
+    size_t GetLength() const { return _length; }
+};
@@ -14,16 +14,280 @@
  *****************************************************************************/
 #pragma endregion
 
+#include <memory>
+#include <string>
 #include <zip.h>
 #include "IStream.hpp"
+#include "Math.hpp"
+#include "String.hpp"
+#include "MemoryMappedFile.h"
 #include "MemoryStream.h"
 #include "Zip.h"
 
+/**
+ * A read-only stream over an entry that is stored without compression, reading straight from the memory
+ * mapped archive.
+ */
+class ZipStoredEntryStream final : public IStream
+{
+private:
+    std::unique_ptr<MemoryMappedFile>   _file;
+    const uint8 *                       _data;
+    uint64                              _length;
+    uint64                              _position = 0;
+
+public:
+    ZipStoredEntryStream(std::unique_ptr<MemoryMappedFile> file, size_t offset, size_t length)
+        : _file(std::move(file)),
+          _data((const uint8 *)_file->GetData() + offset),
+          _length(length)
+    {
+    }
+
+    bool CanRead()  const override { return true;  }
+    bool CanWrite() const override { return false; }
+
+    uint64 GetLength()   const override { return _length;   }
+    uint64 GetPosition() const override { return _position; }
+
+    void SetPosition(uint64 position) override
+    {
+        if (position > _length)
+        {
+            throw IOException("New position out of bounds.");
+        }
+        _position = position;
+    }
+
+    void Seek(sint64 offset, sint32 origin) override
+    {
+        switch (origin) {
+        case STREAM_SEEK_BEGIN:
+            SetPosition(offset);
+            break;
+        case STREAM_SEEK_CURRENT:
+            SetPosition(_position + offset);
+            break;
+        case STREAM_SEEK_END:
+            SetPosition(_length + offset);
+            break;
+        }
+    }
+
+    void Read(void * buffer, uint64 length) override
+    {
+        if (length > _length - _position)
+        {
+            throw IOException("Attempted to read past end of stream.");
+        }
+        Memory::Copy<void>(buffer, _data + _position, (size_t)length);
+        _position += length;
+    }
+
+    void Write(const void * buffer, uint64 length) override
+    {
+        throw IOException("Stream is read-only.");
+    }
+
+    uint64 TryRead(void * buffer, uint64 length) override
+    {
+        uint64 readBytes = Math::Min(length, _length - _position);
+        Read(buffer, readBytes);
+        return readBytes;
+    }
+};
+
+/**
+ * A read-only stream that inflates a compressed entry as it is read, rather than decompressing the whole
+ * entry into memory up front. Seeking backwards reopens the entry and inflates up to the new position.
+ */
+class ZipEntryStream final : public IStream
+{
+private:
+    zip_t *         _zip;
+    zip_file_t *    _zipFile = nullptr;
+    zip_uint64_t    _index;
+    uint64          _length;
+    uint64          _position = 0;
+
+public:
+    ZipEntryStream(const utf8 * archivePath, zip_uint64_t index, uint64 length)
+        : _index(index),
+          _length(length)
+    {
+        sint32 error;
+        _zip = zip_open(archivePath, ZIP_RDONLY, &error);
+        if (_zip == nullptr)
+        {
+            throw IOException("Unable to open zip file.");
+        }
+        Reopen();
+    }
+
+    ~ZipEntryStream() override
+    {
+        if (_zipFile != nullptr)
+        {
+            zip_fclose(_zipFile);
+        }
+        zip_close(_zip);
+    }
+
+    bool CanRead()  const override { return true;  }
+    bool CanWrite() const override { return false; }
+
+    uint64 GetLength()   const override { return _length;   }
+    uint64 GetPosition() const override { return _position; }
+
+    void SetPosition(uint64 position) override
+    {
+        if (position > _length)
+        {
+            throw IOException("New position out of bounds.");
+        }
+        if (position < _position)
+        {
+            Reopen();
+        }
+
+        uint8 buffer[4096];
+        while (_position < position)
+        {
+            Read(buffer, Math::Min<uint64>(sizeof(buffer), position - _position));
+        }
+    }
+
+    void Seek(sint64 offset, sint32 origin) override
+    {
+        switch (origin) {
+        case STREAM_SEEK_BEGIN:
+            SetPosition(offset);
+            break;
+        case STREAM_SEEK_CURRENT:
+            SetPosition(_position + offset);
+            break;
+        case STREAM_SEEK_END:
+            SetPosition(_length + offset);
+            break;
+        }
+    }
+
+    void Read(void * buffer, uint64 length) override
+    {
+        if (length > _length - _position ||
+            zip_fread(_zipFile, buffer, length) != (zip_int64_t)length)
+        {
+            throw IOException("Attempted to read past end of stream.");
+        }
+        _position += length;
+    }
+
+    void Write(const void * buffer, uint64 length) override
+    {
+        throw IOException("Stream is read-only.");
+    }
+
+    uint64 TryRead(void * buffer, uint64 length) override
+    {
+        uint64 readBytes = Math::Min(length, _length - _position);
+        Read(buffer, readBytes);
+        return readBytes;
+    }
+
+private:
+    void Reopen()
+    {
+        if (_zipFile != nullptr)
+        {
+            zip_fclose(_zipFile);
+        }
+        _zipFile = zip_fopen_index(_zip, _index, 0);
+        if (_zipFile == nullptr)
+        {
+            throw IOException("Unable to open zip entry.");
+        }
+        _position = 0;
+    }
+};
+
+template<typename T>
+static T ReadUnaligned(const uint8 * src)
+{
+    T value;
+    Memory::Copy<void>(&value, src, sizeof(T));
+    return value;
+}
+
+/**
+ * Finds where the data of an entry begins within the archive by reading the central directory and the
+ * entry's local header, as libzip does not expose entry offsets. Zip64 archives are not handled.
+ */
+static bool TryGetEntryDataOffset(const uint8 * archive, size_t archiveLength, const utf8 * path, size_t * outOffset)
+{
+    constexpr uint32 EOCD_SIGNATURE = 0x06054B50;
+    constexpr uint32 CENTRAL_HEADER_SIGNATURE = 0x02014B50;
+    constexpr uint32 LOCAL_HEADER_SIGNATURE = 0x04034B50;
+    constexpr size_t EOCD_SIZE = 22;
+    constexpr size_t CENTRAL_HEADER_SIZE = 46;
+    constexpr size_t LOCAL_HEADER_SIZE = 30;
+
+    // Find the end of central directory record, which may be followed by a comment
+    if (archiveLength < EOCD_SIZE)
+    {
+        return false;
+    }
+    size_t eocd = archiveLength - EOCD_SIZE;
+    size_t eocdMin = archiveLength > EOCD_SIZE + UINT16_MAX ? archiveLength - EOCD_SIZE - UINT16_MAX : 0;
+    while (ReadUnaligned<uint32>(archive + eocd) != EOCD_SIGNATURE)
+    {
+        if (eocd == eocdMin)
+        {
+            return false;
+        }
+        eocd--;
+    }
+
+    uint16 numEntries = ReadUnaligned<uint16>(archive + eocd + 10);
+    size_t centralDirectory = ReadUnaligned<uint32>(archive + eocd + 16);
+    size_t pathLength = String::SizeOf(path);
+    size_t entry = centralDirectory;
+    for (uint16 i = 0; i < numEntries; i++)
+    {
+        if (entry + CENTRAL_HEADER_SIZE > archiveLength ||
+            ReadUnaligned<uint32>(archive + entry) != CENTRAL_HEADER_SIGNATURE)
+        {
+            return false;
+        }
+
+        uint16 nameLength = ReadUnaligned<uint16>(archive + entry + 28);
+        uint16 extraLength = ReadUnaligned<uint16>(archive + entry + 30);
+        uint16 commentLength = ReadUnaligned<uint16>(archive + entry + 32);
+        if (nameLength == pathLength &&
+            entry + CENTRAL_HEADER_SIZE + nameLength <= archiveLength &&
+            memcmp(archive + entry + CENTRAL_HEADER_SIZE, path, pathLength) == 0)
+        {
+            size_t localHeader = ReadUnaligned<uint32>(archive + entry + 42);
+            if (localHeader + LOCAL_HEADER_SIZE > archiveLength ||
+                ReadUnaligned<uint32>(archive + localHeader) != LOCAL_HEADER_SIGNATURE)
+            {
+                return false;
+            }
+            uint16 localNameLength = ReadUnaligned<uint16>(archive + localHeader + 26);
+            uint16 localExtraLength = ReadUnaligned<uint16>(archive + localHeader + 28);
+            *outOffset = localHeader + LOCAL_HEADER_SIZE + localNameLength + localExtraLength;
+            return true;
+        }
+        entry += CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+    }
+    return false;
+}
+
 class ZipArchive final : public IZipArchive
 {
 private:
     zip_t *     _zip;
     ZIP_ACCESS  _access;
+    std::string _path;
 
 public:
     ZipArchive(const utf8 * path, ZIP_ACCESS access)
@@ -42,6 +306,7 @@ public:
         }
 
         _access = access;
+        _path = path;
     }
 
     ~ZipArchive() override
@@ -102,6 +367,35 @@ public:
 
     IStream * GetFileStream(const utf8 * path) const override
     {
+        // Entries of an archive that is not being modified can be read without decompressing them up front
+        if (_access == ZIP_ACCESS_READ)
+        {
+            zip_int64_t index = zip_name_locate(_zip, path, 0);
+            zip_stat_t zipFileStat;
+            if (index != -1 && zip_stat_index(_zip, index, 0, &zipFileStat) == ZIP_ER_OK)
+            {
+                try
+                {
+                    if (zipFileStat.comp_method == ZIP_CM_STORE &&
+                        zipFileStat.encryption_method == ZIP_EM_NONE)
+                    {
+                        auto file = std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(_path));
+                        size_t offset;
+                        if (TryGetEntryDataOffset((const uint8 *)file->GetData(), file->GetLength(), path, &offset) &&
+                            offset + zipFileStat.size <= file->GetLength())
+                        {
+                            return new ZipStoredEntryStream(std::move(file), offset, (size_t)zipFileStat.size);
+                        }
+                    }
+                    return new ZipEntryStream(_path.c_str(), index, zipFileStat.size);
+                }
+                catch (const Exception &)
+                {
+                    log_warning("Unable to stream '%s' from zip, reading it into memory.", path);
+                }
+            }
+        }
+
         IStream * stream = nullptr;
         size_t dataSize;
         void * data = GetFileData(path, &dataSize);
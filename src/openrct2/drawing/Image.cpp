@@ -220,10 +220,18 @@ extern "C"
             return INVALID_IMAGE_ID;
         }
 
+        // Without images (no graphics or images read on demand) only the image IDs are reserved
         uint32 imageId = baseImageId;
         for (uint32 i = 0; i < count; i++)
         {
-            g1Elements[imageId] = images[i];
+            if (images != nullptr)
+            {
+                g1Elements[imageId] = images[i];
+            }
+            else
+            {
+                g1Elements[imageId] = { 0 };
+            }
             drawing_engine_invalidate_image(imageId);
             imageId++;
         }
@@ -29,6 +29,7 @@ extern "C"
     #include "../drawing/drawing.h"
     #include "../interface/screenshot.h"
     #include "../localisation/string_ids.h"
+    #include "../object.h"
     #include "../platform/platform.h"
     #include "../rct2.h"
 }
@@ -154,6 +155,7 @@ extern "C"
 
     void drawing_engine_draw()
     {
+        object_image_table_evict_unused();
         if (_drawingEngine != nullptr)
         {
             _drawingEngine->Draw();
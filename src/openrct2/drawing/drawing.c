@@ -20,6 +20,8 @@
 #include "../interface/window.h"
 #include "../localisation/localisation.h"
 #include "../object.h"
+#include "../OpenRCT2.h"
+#include "../paint/paint.h"
 #include "../platform/platform.h"
 #include "../rct2.h"
 #include "../world/water.h"
@@ -495,7 +497,11 @@ void gfx_filter_pixel(rct_drawpixelinfo *dpi, sint32 x, sint32 y, FILTER_PALETTE
  */
 void gfx_transpose_palette(sint32 pal, uint8 product)
 {
-    rct_g1_element g1 = g1Elements[pal];
+    if (gOpenRCT2NoGraphics) {
+        return;
+    }
+
+    rct_g1_element g1 = *gfx_get_g1_element(pal);
     sint32 width = g1.width;
     sint32 x = g1.x_offset;
     uint8* dest_pointer = &gGamePalette[x * 4];
@@ -517,6 +523,10 @@ void gfx_transpose_palette(sint32 pal, uint8 product)
  */
 void load_palette()
 {
+    if (gOpenRCT2NoGraphics) {
+        return;
+    }
+
     rct_water_type* water_type = (rct_water_type*)object_entry_groups[OBJECT_TYPE_WATER].chunks[0];
 
     uint32 palette = 0x5FC;
@@ -526,7 +536,7 @@ void load_palette()
         palette = water_type->image_id;
     }
 
-    rct_g1_element g1 = g1Elements[palette];
+    rct_g1_element g1 = *gfx_get_g1_element(palette);
     sint32 width = g1.width;
     sint32 x = g1.x_offset;
     uint8* dest_pointer = &gGamePalette[x * 4];
@@ -549,6 +559,7 @@ void load_palette()
  */
 void gfx_invalidate_screen()
 {
+    paint_tile_cache_invalidate_all();
     gfx_set_dirty_blocks(0, 0, context_get_width(), context_get_height());
 }
 
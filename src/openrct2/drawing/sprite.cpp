@@ -21,6 +21,7 @@
 #include "../core/File.h"
 #include "../core/FileStream.hpp"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Util.hpp"
 #include "../OpenRCT2.h"
 #include "../sprites.h"
@@ -28,6 +29,7 @@
 
 extern "C"
 {
+    #include "../object.h"
     #include "../rct2/addresses.h"
     #include "../util/util.h"
     #include "drawing.h"
@@ -36,6 +38,11 @@ extern "C"
 using namespace OpenRCT2;
 using namespace OpenRCT2::Ui;
 
+// Number of elements in g1.dat
+constexpr uint32 G1_ENTRY_COUNT = 29294;
+// Size of the g1 element table, which also holds the images allocated for objects
+constexpr uint32 G1_ELEMENT_COUNT = 324206;
+
 extern "C"
 {
     static void *   _g1Buffer = nullptr;
@@ -43,6 +50,10 @@ extern "C"
     static rct_gx   _csg = { 0 };
     static bool     _csgLoaded = false;
 
+    static MemoryMappedFile * _g1Map = nullptr;
+    static MemoryMappedFile * _g2Map = nullptr;
+    static MemoryMappedFile * _csgMap = nullptr;
+
     #ifdef NO_RCT2
         rct_g1_element * g1Elements = nullptr;
     #else
@@ -82,6 +93,47 @@ extern "C"
         Memory::Free(g1Elements32);
     }
 
+    /**
+     * Maps the sprite data of a graphics file read-only so that pages are only loaded
+     * when a sprite is drawn and are shared with other processes using the same file.
+     * Falls back to reading the data onto the heap if the file can not be mapped.
+     */
+    static void * map_gxdat_data(const utf8 * path, IStream * stream, size_t length, MemoryMappedFile * * outMap)
+    {
+        size_t dataOffset = (size_t)stream->GetPosition();
+        try
+        {
+            auto map = new MemoryMappedFile(path);
+            if (map->GetLength() >= dataOffset + length)
+            {
+                *outMap = map;
+                return (void *)((uintptr_t)map->GetData() + dataOffset);
+            }
+            delete map;
+        }
+        catch (const Exception &)
+        {
+        }
+
+        log_verbose("Unable to map '%s', reading into memory instead.", path);
+        *outMap = nullptr;
+        return stream->ReadArray<uint8>(length);
+    }
+
+    static void unload_gxdat_data(void * * data, MemoryMappedFile * * map)
+    {
+        if (*map != nullptr)
+        {
+            delete *map;
+            *map = nullptr;
+            *data = nullptr;
+        }
+        else
+        {
+            SafeFree(*data);
+        }
+    }
+
     /**
      *
      *  rct2: 0x00678998
@@ -89,25 +141,35 @@ extern "C"
     bool gfx_load_g1()
     {
         log_verbose("gfx_load_g1()");
+        if (gOpenRCT2NoGraphics)
+        {
+            // Sprites are never drawn, keep an empty element table for object image allocation
+#ifdef NO_RCT2
+            g1Elements = Memory::AllocateArrayZeroed<rct_g1_element>(G1_ELEMENT_COUNT);
+#endif
+            return true;
+        }
+
         try
         {
-            auto fs = FileStream(get_file_path(PATH_ID_G1), FILE_MODE_OPEN);
+            const utf8 * path = get_file_path(PATH_ID_G1);
+            auto fs = FileStream(path, FILE_MODE_OPEN);
             rct_g1_header header = fs.ReadValue<rct_g1_header>();
 
             /* number of elements is stored in g1.dat, but because the entry
              * headers are static, this can't be variable until made into a
              * dynamic array.
              */
-            header.num_entries = 29294;
+            header.num_entries = G1_ENTRY_COUNT;
 
             // Read element headers
 #ifdef NO_RCT2
-            g1Elements = Memory::AllocateArray<rct_g1_element>(324206);
+            g1Elements = Memory::AllocateArray<rct_g1_element>(G1_ELEMENT_COUNT);
 #endif
             read_and_convert_gxdat(&fs, header.num_entries, g1Elements);
 
             // Read element data
-            _g1Buffer = fs.ReadArray<uint8>(header.total_size);
+            _g1Buffer = map_gxdat_data(path, &fs, header.total_size, &_g1Map);
 
             // Fix entry data offsets
             for (uint32 i = 0; i < header.num_entries; i++)
@@ -130,7 +192,7 @@ extern "C"
 
     void gfx_unload_g1()
     {
-        SafeFree(_g1Buffer);
+        unload_gxdat_data(&_g1Buffer, &_g1Map);
     #ifdef NO_RCT2
         SafeFree(g1Elements);
     #endif
@@ -139,18 +201,22 @@ extern "C"
     void gfx_unload_g2()
     {
         SafeFree(_g2.elements);
-        SafeFree(_g2.data);
+        unload_gxdat_data(&_g2.data, &_g2Map);
     }
 
     void gfx_unload_csg()
     {
         SafeFree(_csg.elements);
-        SafeFree(_csg.data);
+        unload_gxdat_data(&_csg.data, &_csgMap);
     }
 
     bool gfx_load_g2()
     {
         log_verbose("gfx_load_g2()");
+        if (gOpenRCT2NoGraphics)
+        {
+            return true;
+        }
 
         char path[MAX_PATH];
 
@@ -166,7 +232,7 @@ extern "C"
             read_and_convert_gxdat(&fs, _g2.header.num_entries, _g2.elements);
 
             // Read element data
-            _g2.data = fs.ReadArray<uint8>(_g2.header.total_size);
+            _g2.data = map_gxdat_data(path, &fs, _g2.header.total_size, &_g2Map);
 
             // Fix entry data offsets
             for (uint32 i = 0; i < _g2.header.num_entries; i++)
@@ -190,6 +256,10 @@ extern "C"
     bool gfx_load_csg()
     {
         log_verbose("gfx_load_csg()");
+        if (gOpenRCT2NoGraphics)
+        {
+            return false;
+        }
 
         if (str_is_null_or_empty(gConfigGeneral.rct1_path))
         {
@@ -233,7 +303,7 @@ extern "C"
             read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, _csg.elements);
 
             // Read element data
-            _csg.data = fileData.ReadArray<uint8>(_csg.header.total_size);
+            _csg.data = map_gxdat_data(pathData, &fileData, _csg.header.total_size, &_csgMap);
 
             // Fix entry data offsets
             for (uint32 i = 0; i < _csg.header.num_entries; i++)
@@ -585,8 +655,8 @@ extern "C"
     void FASTCALL gfx_draw_sprite_raw_masked_software(rct_drawpixelinfo *dpi, sint32 x, sint32 y, sint32 maskImage, sint32 colourImage)
     {
         sint32 left, top, right, bottom, width, height;
-        rct_g1_element *imgMask = &g1Elements[maskImage & 0x7FFFF];
-        rct_g1_element *imgColour = &g1Elements[colourImage & 0x7FFFF];
+        rct_g1_element *imgMask = gfx_get_g1_element(maskImage & 0x7FFFF);
+        rct_g1_element *imgColour = gfx_get_g1_element(colourImage & 0x7FFFF);
 
         assert(imgMask->flags & G1_FLAG_BMP);
         assert(imgColour->flags & G1_FLAG_BMP);
@@ -644,6 +714,8 @@ extern "C"
     {
         if (image_id < SPR_G2_BEGIN)
         {
+            // Object images may need their data read before they can be drawn
+            object_image_table_touch(image_id);
             return &g1Elements[image_id];
         }
         if (image_id < SPR_CSG_BEGIN)
@@ -33,10 +33,13 @@
 #include "network/network.h"
 #include "object.h"
 #include "OpenRCT2.h"
+#include "paint/paint.h"
 #include "peep/peep.h"
 #include "peep/staff.h"
 #include "platform/platform.h"
 #include "rct1.h"
+#include "Replay.h"
+#include "ride/RideIndex.h"
 #include "ride/ride.h"
 #include "ride/ride_ratings.h"
 #include "ride/track.h"
@@ -48,11 +51,13 @@
 #include "util/util.h"
 #include "windows/error.h"
 #include "windows/tooltip.h"
+#include "world/AmenityField.h"
 #include "world/Climate.h"
 #include "world/entrance.h"
 #include "world/footpath.h"
 #include "world/map_animation.h"
 #include "world/park.h"
+#include "world/ParkStats.h"
 #include "world/scenery.h"
 #include "world/sprite.h"
 #include "world/water.h"
@@ -161,6 +166,10 @@ enum {
 */
 void update_palette_effects()
 {
+    if (gOpenRCT2NoGraphics) {
+        return;
+    }
+
     rct_water_type* water_type = (rct_water_type*)object_entry_groups[OBJECT_TYPE_WATER].chunks[0];
 
     if (gClimateLightningFlash == 1) {
@@ -170,7 +179,7 @@ void update_palette_effects()
         if ((intptr_t)water_type != -1) {
             palette = water_type->image_id;
         }
-        rct_g1_element g1_element = g1Elements[palette];
+        rct_g1_element g1_element = *gfx_get_g1_element(palette);
         sint32 xoffset = g1_element.x_offset;
         xoffset = xoffset * 4;
         uint8 *paletteOffset = gGamePalette + xoffset;
@@ -190,7 +199,7 @@ void update_palette_effects()
                 palette = water_type->image_id;
             }
 
-            rct_g1_element g1_element = g1Elements[palette];
+            rct_g1_element g1_element = *gfx_get_g1_element(palette);
             sint32 xoffset = g1_element.x_offset;
             xoffset = xoffset * 4;
             uint8 *paletteOffset = gGamePalette + xoffset;
@@ -219,7 +228,7 @@ void update_palette_effects()
         if ((intptr_t)water_type != -1) {
             waterId = water_type->palette_index_1;
         }
-        rct_g1_element g1_element = g1Elements[shade + waterId];
+        rct_g1_element g1_element = *gfx_get_g1_element(shade + waterId);
         uint8* vs = &g1_element.offset[j * 3];
         uint8* vd = &gGamePalette[230 * 4];
         sint32 n = 5;
@@ -238,7 +247,7 @@ void update_palette_effects()
         if ((intptr_t)water_type != -1) {
             waterId = water_type->palette_index_2;
         }
-        g1_element = g1Elements[shade + waterId];
+        g1_element = *gfx_get_g1_element(shade + waterId);
         vs = &g1_element.offset[j * 3];
         n = 5;
         for (sint32 i = 0; i < n; i++) {
@@ -254,7 +263,7 @@ void update_palette_effects()
 
         j = ((uint16)(gPaletteEffectFrame * -960) * 3) >> 16;
         waterId = SPR_GAME_PALETTE_4;
-        g1_element = g1Elements[shade + waterId];
+        g1_element = *gfx_get_g1_element(shade + waterId);
         vs = &g1_element.offset[j * 3];
         vd += 12;
         n = 3;
@@ -368,6 +377,29 @@ void game_update()
     }
 }
 
+/**
+ * Runs a batch of game ticks for headless fast-forward. Input, windows and drawing are
+ * skipped as nothing is presented, the network and autosave are serviced once per batch.
+ */
+void game_update_headless(sint32 numUpdates)
+{
+    network_update();
+
+    if (game_is_paused()) {
+        numUpdates = 0;
+    }
+
+    for (sint32 i = 0; i < numUpdates; i++) {
+        game_logic_update();
+    }
+
+    if (!(gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && !(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)) {
+        scenario_autosave_check();
+    }
+
+    gGameCommandNestLevel = 0;
+}
+
 void game_logic_update()
 {
     ///////////////////////////
@@ -387,6 +419,8 @@ void game_logic_update()
         gScreenAge--;
 
     sub_68B089();
+    // Guests and rides are counted again for the date and park updates of each tick
+    park_stats_invalidate();
     scenario_update();
     climate_update();
     map_update_tiles();
@@ -398,6 +432,7 @@ void game_logic_update()
     vehicle_update_all();
     sprite_misc_update_all();
     ride_update_all();
+    park_stats_invalidate();
     park_update();
     research_update();
     ride_ratings_update_all();
@@ -407,10 +442,14 @@ void game_logic_update()
     gInUpdateCode = false;
     ///////////////////////////
 
+    replay_record_tick();
+
     map_animation_invalidate_all();
-    vehicle_sounds_update();
-    peep_update_crowd_noise();
-    climate_update_sound();
+    if (!gOpenRCT2Headless) {
+        vehicle_sounds_update();
+        peep_update_crowd_noise();
+        climate_update_sound();
+    }
     editor_open_windows_for_current_step();
 
     gSavedAge++;
@@ -475,9 +514,11 @@ sint32 game_do_command(sint32 eax, sint32 ebx, sint32 ecx, sint32 edx, sint32 es
 sint32 game_do_command_p(sint32 command, sint32 *eax, sint32 *ebx, sint32 *ecx, sint32 *edx, sint32 *esi, sint32 *edi, sint32 *ebp)
 {
     sint32 cost, flags;
-    sint32 original_ebx, original_edx, original_esi, original_edi, original_ebp;
+    sint32 original_eax, original_ebx, original_ecx, original_edx, original_esi, original_edi, original_ebp;
 
     *esi = command;
+    original_eax = *eax;
+    original_ecx = *ecx;
     original_ebx = *ebx;
     original_edx = *edx;
     original_esi = *esi;
@@ -556,9 +597,25 @@ sint32 game_do_command_p(sint32 command, sint32 *eax, sint32 *ebx, sint32 *ecx,
                 }
             }
 
+            // Record top-level commands from players, not those the game runs itself during an update or those
+            // building a track design preview in the scratch map
+            if (gGameCommandNestLevel == 1 && (!gInUpdateCode || (flags & GAME_COMMAND_FLAG_NETWORKED)) && !gTrackDesignPreviewActive) {
+                replay_record_command(command, original_eax, original_ebx, original_ecx, original_edx, original_edi, original_ebp, game_command_playerid);
+            }
+
             // Second call to actually perform the operation
             new_game_command_table[command](eax, ebx, ecx, edx, esi, edi, ebp);
 
+            // Commands can change any part of the map or the rides on it, painted tiles are
+            // invalidated by the map as each one changes
+            if (!(flags & GAME_COMMAND_FLAG_GHOST)) {
+                // Ghost elements are left out of the ride index and amenity field and are never owned land
+                ride_index_invalidate();
+                amenity_field_invalidate();
+                park_stats_invalidate_land();
+            }
+            park_stats_invalidate();
+
             // Do the callback (required for multiplayer to work correctly), but only for top level commands
             if (gGameCommandNestLevel == 1) {
                 if (game_command_callback && !(flags & GAME_COMMAND_FLAG_GHOST)) {
@@ -1153,6 +1210,13 @@ void game_load_init()
     }
 
     gGameSpeed = 1;
+
+    ride_index_invalidate();
+    amenity_field_invalidate();
+    park_stats_invalidate();
+    park_stats_invalidate_land();
+    peep_sort_names_invalidate();
+    replay_park_loaded();
 }
 
 /**
@@ -160,6 +160,7 @@ void game_reduce_game_speed();
 void game_create_windows();
 void game_update();
 void game_logic_update();
+void game_update_headless(sint32 numUpdates);
 void reset_all_sprite_quadrant_placements();
 void update_palette_effects();
 
@@ -15,6 +15,7 @@
 #pragma endregion
 
 #include "../drawing/drawing.h"
+#include "../OpenRCT2.h"
 #include "colour.h"
 #include "../sprites.h"
 
@@ -38,6 +39,10 @@ enum
 
 void colours_init_maps()
 {
+    if (gOpenRCT2NoGraphics) {
+        return;
+    }
+
     // Get colour maps from g1
     for (sint32 i = 0; i < 32; i++) {
         rct_g1_element *g1Element = &g1Elements[SPR_PALETTE_2_START + i];
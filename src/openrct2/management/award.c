@@ -20,7 +20,7 @@
 #include "../peep/peep.h"
 #include "../ride/ride.h"
 #include "../scenario/scenario.h"
-#include "../world/sprite.h"
+#include "../world/ParkStats.h"
 #include "award.h"
 #include "news_item.h"
 
@@ -76,13 +76,17 @@ bool award_is_positive(sint32 type)
 
 #pragma region Award checks
 
+static sint32 award_count_untidy_thoughts(const park_stats *stats)
+{
+    return
+        stats->recent_thoughts[PEEP_THOUGHT_TYPE_BAD_LITTER] +
+        stats->recent_thoughts[PEEP_THOUGHT_TYPE_PATH_DISGUSTING] +
+        stats->recent_thoughts[PEEP_THOUGHT_TYPE_VANDALISM];
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static sint32 award_is_deserved_most_untidy(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint16 spriteIndex;
-    rct_peep *peep;
-    sint32 negativeCount;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_BEAUTIFUL))
         return 0;
     if (activeAwardTypes & (1 << PARK_AWARD_BEST_STAFF))
@@ -90,84 +94,28 @@ static sint32 award_is_deserved_most_untidy(sint32 awardType, sint32 activeAward
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_TIDY))
         return 0;
 
-    negativeCount = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].var_2 > 5)
-            continue;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BAD_LITTER ||
-            peep->thoughts[0].type == PEEP_THOUGHT_TYPE_PATH_DISGUSTING ||
-            peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM
-        ) {
-            negativeCount++;
-        }
-    }
-
+    sint32 negativeCount = award_count_untidy_thoughts(park_stats_get());
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
 static sint32 award_is_deserved_most_tidy(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint16 spriteIndex;
-    rct_peep *peep;
-    sint32 positiveCount;
-    sint32 negativeCount;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_UNTIDY))
         return 0;
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_DISAPPOINTING))
         return 0;
 
-    positiveCount = 0;
-    negativeCount = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].var_2 > 5)
-            continue;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VERY_CLEAN)
-            positiveCount++;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BAD_LITTER ||
-            peep->thoughts[0].type == PEEP_THOUGHT_TYPE_PATH_DISGUSTING ||
-            peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM
-        ) {
-            negativeCount++;
-        }
-    }
-
+    const park_stats *stats = park_stats_get();
+    sint32 positiveCount = stats->recent_thoughts[PEEP_THOUGHT_TYPE_VERY_CLEAN];
+    sint32 negativeCount = award_count_untidy_thoughts(stats);
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
 /** At least 6 open roller coasters. */
 static sint32 award_is_deserved_best_rollercoasters(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, rollerCoasters;
-    rct_ride *ride;
-    rct_ride_entry *rideType;
-
-    rollerCoasters = 0;
-    FOR_ALL_RIDES(i, ride) {
-        rideType = get_ride_entry(ride->subtype);
-        if (rideType == NULL) {
-            continue;
-        }
-        if (rideType->category[0] != RIDE_GROUP_ROLLERCOASTER && rideType->category[1] != RIDE_GROUP_ROLLERCOASTER)
-            continue;
-
-        if (ride->status != RIDE_STATUS_OPEN || (ride->lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-            continue;
-
-        rollerCoasters++;
-    }
-
-    return (rollerCoasters >= 6);
+    return (park_stats_get()->open_rollercoasters >= 6);
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
@@ -189,36 +137,14 @@ static sint32 award_is_deserved_best_value(sint32 awardType, sint32 activeAwardT
 /** More than 1/128 of the total guests must be thinking scenic thoughts and less than 16 untidy thoughts. */
 static sint32 award_is_deserved_most_beautiful(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint16 spriteIndex;
-    rct_peep *peep;
-    sint32 positiveCount;
-    sint32 negativeCount;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_UNTIDY))
         return 0;
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_DISAPPOINTING))
         return 0;
 
-    positiveCount = 0;
-    negativeCount = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].var_2 > 5)
-            continue;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_SCENERY)
-            positiveCount++;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BAD_LITTER ||
-            peep->thoughts[0].type == PEEP_THOUGHT_TYPE_PATH_DISGUSTING ||
-            peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM
-        ) {
-            negativeCount++;
-        }
-    }
-
+    const park_stats *stats = park_stats_get();
+    sint32 positiveCount = stats->recent_thoughts[PEEP_THOUGHT_TYPE_SCENERY];
+    sint32 negativeCount = award_count_untidy_thoughts(stats);
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
@@ -241,26 +167,13 @@ static sint32 award_is_deserved_worse_value(sint32 awardType, sint32 activeAward
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static sint32 award_is_deserved_safest(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, peepsWhoDislikeVandalism;
-    uint16 spriteIndex;
-    rct_peep *peep;
-    rct_ride *ride;
-
-    peepsWhoDislikeVandalism = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-        if (peep->thoughts[0].var_2 <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM)
-            peepsWhoDislikeVandalism++;
-    }
-
-    if (peepsWhoDislikeVandalism > 2)
+    const park_stats *stats = park_stats_get();
+    if (stats->recent_thoughts[PEEP_THOUGHT_TYPE_VANDALISM] > 2)
         return 0;
 
     // Check for rides that have crashed maybe?
-    FOR_ALL_RIDES(i, ride)
-        if (ride->last_crash_type != RIDE_CRASH_TYPE_NONE)
-            return 0;
+    if (stats->any_ride_crashed)
+        return 0;
 
     return 1;
 }
@@ -268,141 +181,46 @@ static sint32 award_is_deserved_safest(sint32 awardType, sint32 activeAwardTypes
 /** All staff types, at least 20 staff, one staff per 32 peeps. */
 static sint32 award_is_deserved_best_staff(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint16 spriteIndex;
-    rct_peep *peep;
-    sint32 peepCount, staffCount;
-    sint32 staffTypeFlags;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_UNTIDY))
         return 0;
 
-    peepCount = 0;
-    staffCount = 0;
-    staffTypeFlags = 0;
-    FOR_ALL_PEEPS(spriteIndex, peep) {
-        if (peep->type == PEEP_TYPE_STAFF) {
-            staffCount++;
-            staffTypeFlags |= (1 << peep->staff_type);
-        } else {
-            peepCount++;
-        }
-    }
-
-    return ((staffTypeFlags & 0xF) && staffCount >= 20 && staffCount >= peepCount / 32);
-
+    const park_stats *stats = park_stats_get();
+    return ((stats->staff_type_flags & 0xF) && stats->staff >= 20 && stats->staff >= stats->guests / 32);
 }
 
 /** At least 7 shops, 4 unique, one shop per 128 guests and no more than 12 hungry guests. */
 static sint32 award_is_deserved_best_food(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, hungryPeeps, shops, uniqueShops;
-    uint64 shopTypes;
-    rct_ride *ride;
-    rct_ride_entry *rideType;
-    uint16 spriteIndex;
-    rct_peep *peep;
-
     if (activeAwardTypes & (1 << PARK_AWARD_WORST_FOOD))
         return 0;
 
-    shops = 0;
-    uniqueShops = 0;
-    shopTypes = 0;
-    FOR_ALL_RIDES(i, ride) {
-        if (ride->status != RIDE_STATUS_OPEN)
-            continue;
-        if (!ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        rideType = get_ride_entry(ride->subtype);
-        if (rideType == NULL) {
-            continue;
-        }
-        if (!(shopTypes & (1ULL << rideType->shop_item))) {
-            shopTypes |= (1ULL << rideType->shop_item);
-            uniqueShops++;
-        }
-    }
-
-    if (shops < 7 || uniqueShops < 4 || shops < gNumGuestsInPark / 128)
+    const park_stats *stats = park_stats_get();
+    sint32 shops = stats->open_food_stalls;
+    if (shops < 7 || stats->open_food_stall_items < 4 || shops < gNumGuestsInPark / 128)
         return 0;
 
-    // Count hungry peeps
-    hungryPeeps = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].var_2 <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_HUNGRY)
-            hungryPeeps++;
-    }
-
-    return (hungryPeeps <= 12);
+    return (stats->recent_thoughts[PEEP_THOUGHT_TYPE_HUNGRY] <= 12);
 }
 
 /** No more than 2 unique shops, less than one shop per 256 guests and more than 15 hungry guests. */
 static sint32 award_is_deserved_worst_food(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, hungryPeeps, shops, uniqueShops;
-    uint64 shopTypes;
-    rct_ride *ride;
-    rct_ride_entry *rideType;
-    uint16 spriteIndex;
-    rct_peep *peep;
-
     if (activeAwardTypes & (1 << PARK_AWARD_BEST_FOOD))
         return 0;
 
-    shops = 0;
-    uniqueShops = 0;
-    shopTypes = 0;
-    FOR_ALL_RIDES(i, ride) {
-        if (ride->status != RIDE_STATUS_OPEN)
-            continue;
-        if (!ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        rideType = get_ride_entry(ride->subtype);
-        if (rideType == NULL) {
-            continue;
-        }
-        if (!(shopTypes & (1ULL << rideType->shop_item))) {
-            shopTypes |= (1ULL << rideType->shop_item);
-            uniqueShops++;
-        }
-    }
-
-    if (uniqueShops > 2 || shops > gNumGuestsInPark / 256)
+    const park_stats *stats = park_stats_get();
+    sint32 shops = stats->open_food_stalls;
+    if (stats->open_food_stall_items > 2 || shops > gNumGuestsInPark / 256)
         return 0;
 
-    // Count hungry peeps
-    hungryPeeps = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].var_2 <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_HUNGRY)
-            hungryPeeps++;
-    }
-
-    return (hungryPeeps > 15);
+    return (stats->recent_thoughts[PEEP_THOUGHT_TYPE_HUNGRY] > 15);
 }
 
 /** At least 4 restrooms, 1 restroom per 128 guests and no more than 16 guests who think they need the restroom. */
 static sint32 award_is_deserved_best_restrooms(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint32 i, numRestrooms, guestsWhoNeedRestroom;
-    rct_ride *ride;
-    uint16 spriteIndex;
-    rct_peep *peep;
-
-    // Count open restrooms
-    numRestrooms = 0;
-    FOR_ALL_RIDES(i, ride)
-        if (ride->type == RIDE_TYPE_TOILETS && ride->status == RIDE_STATUS_OPEN)
-            numRestrooms++;
+    const park_stats *stats = park_stats_get();
+    uint32 numRestrooms = stats->open_restrooms;
 
     // At least 4 open restrooms
     if (numRestrooms < 4)
@@ -412,175 +230,65 @@ static sint32 award_is_deserved_best_restrooms(sint32 awardType, sint32 activeAw
     if (numRestrooms < gNumGuestsInPark / 128U)
         return 0;
 
-    // Count number of guests who are thinking they need the restroom
-    guestsWhoNeedRestroom = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].var_2 <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BATHROOM)
-            guestsWhoNeedRestroom++;
-    }
-
-    return (guestsWhoNeedRestroom <= 16);
+    // Guests who are thinking they need the restroom
+    return (stats->recent_thoughts[PEEP_THOUGHT_TYPE_BATHROOM] <= 16);
 }
 
 /** More than half of the rides have satisfaction <= 6 and park rating <= 650. */
 static sint32 award_is_deserved_most_disappointing(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint32 i, countedRides, disappointingRides;
-    rct_ride *ride;
-
     if (activeAwardTypes & (1 << PARK_AWARD_BEST_VALUE))
         return 0;
     if (gParkRating > 650)
         return 0;
 
-    // Count the number of disappointing rides
-    countedRides = 0;
-    disappointingRides = 0;
-
-    FOR_ALL_RIDES(i, ride) {
-        if (ride->excitement == RIDE_RATING_UNDEFINED || ride->popularity == 0xFF)
-            continue;
-
-        countedRides++;
-
-        // Unpopular
-        if (ride->popularity <= 6)
-            disappointingRides++;
-    }
-
     // Half of the rides are disappointing
+    const park_stats *stats = park_stats_get();
+    uint32 countedRides = stats->popular_rides_counted;
+    uint32 disappointingRides = stats->unpopular_rides;
     return (disappointingRides >= countedRides / 2);
 }
 
 /** At least 6 open water rides. */
 static sint32 award_is_deserved_best_water_rides(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, waterRides;
-    rct_ride *ride;
-    rct_ride_entry *rideType;
-
-    waterRides = 0;
-    FOR_ALL_RIDES(i, ride) {
-        rideType = get_ride_entry(ride->subtype);
-        if (rideType == NULL) {
-            continue;
-        }
-        if (rideType->category[0] != RIDE_GROUP_WATER && rideType->category[1] != RIDE_GROUP_WATER)
-            continue;
-
-        if (ride->status != RIDE_STATUS_OPEN || (ride->lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-            continue;
-
-        waterRides++;
-    }
-
-    return (waterRides >= 6);
+    return (park_stats_get()->open_water_rides >= 6);
 }
 
 /** At least 6 custom designed rides. */
 static sint32 award_is_deserved_best_custom_designed_rides(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, customDesignedRides;
-    rct_ride *ride;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_DISAPPOINTING))
         return 0;
 
-    customDesignedRides = 0;
-    FOR_ALL_RIDES(i, ride) {
-        if (!ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_HAS_TRACK))
-            continue;
-        if (ride->lifecycle_flags & RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN)
-            continue;
-        if (ride->excitement < RIDE_RATING(5, 50))
-            continue;
-        if (ride->status != RIDE_STATUS_OPEN || (ride->lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-            continue;
-
-        customDesignedRides++;
-    }
-
-    return (customDesignedRides >= 6);
+    return (park_stats_get()->open_custom_designed_rides >= 6);
 }
 
 /** At least 5 colourful rides and more than half of the rides are colourful. */
-const uint8 dazzling_ride_colours[] = { 5, 14, 20, 30 };
 static sint32 award_is_deserved_most_dazzling_ride_colours(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, j, countedRides, colourfulRides;
-    rct_ride *ride;
-    uint8 mainTrackColour;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_DISAPPOINTING))
         return 0;
 
-    countedRides = 0;
-    colourfulRides = 0;
-    FOR_ALL_RIDES(i, ride) {
-        if (!ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_HAS_TRACK))
-            continue;
-
-        countedRides++;
-
-        mainTrackColour = ride->track_colour_main[0];
-        for (j = 0; j < countof(dazzling_ride_colours); j++) {
-            if (mainTrackColour == dazzling_ride_colours[j]) {
-                colourfulRides++;
-                break;
-            }
-        }
-    }
-
+    const park_stats *stats = park_stats_get();
+    sint32 countedRides = stats->track_rides;
+    sint32 colourfulRides = stats->dazzling_track_rides;
     return (colourfulRides >= 5 && colourfulRides >= countedRides - colourfulRides);
 }
 
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static sint32 award_is_deserved_most_confusing_layout(sint32 awardType, sint32 activeAwardTypes)
 {
-    uint32 peepsCounted, peepsLost;
-    uint16 spriteIndex;
-    rct_peep *peep;
-
-    peepsCounted = 0;
-    peepsLost = 0;
-    FOR_ALL_GUESTS(spriteIndex, peep) {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        peepsCounted++;
-        if (peep->thoughts[0].var_2 <= 5 && (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_LOST || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_CANT_FIND))
-            peepsLost++;
-    }
-
+    const park_stats *stats = park_stats_get();
+    uint32 peepsCounted = stats->guests_in_park;
+    uint32 peepsLost = stats->recent_thoughts[PEEP_THOUGHT_TYPE_LOST] + stats->recent_thoughts[PEEP_THOUGHT_TYPE_CANT_FIND];
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
 
 /** At least 10 open gentle rides. */
 static sint32 award_is_deserved_best_gentle_rides(sint32 awardType, sint32 activeAwardTypes)
 {
-    sint32 i, gentleRides;
-    rct_ride *ride;
-    rct_ride_entry *rideType;
-
-    gentleRides = 0;
-    FOR_ALL_RIDES(i, ride) {
-        rideType = get_ride_entry(ride->subtype);
-        if (rideType == NULL) {
-            continue;
-        }
-        if (rideType->category[0] != RIDE_GROUP_GENTLE && rideType->category[1] != RIDE_GROUP_GENTLE)
-            continue;
-
-        if (ride->status != RIDE_STATUS_OPEN || (ride->lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-            continue;
-
-        gentleRides++;
-    }
-
-    return (gentleRides >= 10);
+    return (park_stats_get()->open_gentle_rides >= 10);
 }
 
 typedef sint32 (*award_deserved_check)(sint32, sint32);
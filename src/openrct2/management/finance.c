@@ -19,9 +19,11 @@
 #include "../localisation/date.h"
 #include "../localisation/localisation.h"
 #include "../peep/peep.h"
+#include "../peep/staff.h"
 #include "../ride/ride.h"
 #include "../util/util.h"
 #include "../world/park.h"
+#include "../world/ParkStats.h"
 #include "../world/sprite.h"
 #include "finance.h"
 
@@ -221,12 +223,11 @@ void finance_update_daily_profit()
 
     if (!(gParkFlags & PARK_FLAGS_NO_MONEY))
     {
-        // Staff costs
-        uint16 sprite_index;
-        rct_peep *peep;
+        const park_stats *stats = park_stats_get();
 
-        FOR_ALL_STAFF(sprite_index, peep) {
-            current_profit -= wage_table[peep->staff_type];
+        // Staff costs
+        for (sint32 i = 0; i < STAFF_TYPE_COUNT; i++) {
+            current_profit -= stats->staff_by_type[i] * wage_table[i];
         }
 
         // Research costs
@@ -238,13 +239,7 @@ void finance_update_daily_profit()
         current_profit -= current_loan / 600;
 
         // Ride costs
-        rct_ride *ride;
-        sint32 i;
-        FOR_ALL_RIDES(i, ride) {
-            if (ride->status != RIDE_STATUS_CLOSED && ride->upkeep_cost != -1) {
-                current_profit -= 2 * ride->upkeep_cost;
-            }
-        }
+        current_profit -= stats->total_ride_upkeep;
     }
 
     // This is not equivalent to / 4 due to rounding of negative numbers
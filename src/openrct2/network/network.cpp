@@ -188,7 +188,7 @@ void Network::Close()
     SafeDelete(server_connection);
 
     client_connection_list.clear();
-    game_command_queue.clear();
+    ClearGameCommandQueue();
     player_list.clear();
     group_list.clear();
 
@@ -1311,9 +1311,24 @@ void Network::ProcessPacket(NetworkConnection& connection, NetworkPacket& packet
 
 void Network::ProcessGameCommandQueue()
 {
-    while (game_command_queue.begin() != game_command_queue.end() && game_command_queue.begin()->tick == gCurrentTicks) {
+    // Find the commands for the current tick, they are contiguous at the front of the queue
+    size_t tickEnd = game_command_queue_head;
+    while (tickEnd < game_command_queue.size() && game_command_queue[tickEnd].tick == gCurrentTicks) {
+        tickEnd++;
+    }
+    if (tickEnd == game_command_queue_head) {
+        return;
+    }
+
+    uint32 now = platform_get_ticks();
+    for (size_t i = game_command_queue_head; i < tickEnd; i++) {
         // run all the game commands at the current tick
-        const GameCommand& gc = (*game_command_queue.begin());
+        const GameCommand gc = game_command_queue[i];
+        uint32 latency = now - gc.receivedTime;
+        game_command_latency_total += latency;
+        game_command_latency_max = std::max(game_command_latency_max, latency);
+        game_commands_processed++;
+
         if (GetPlayerID() == gc.playerid) {
             game_command_callback = game_command_callback_get_callback(gc.callback);
         }
@@ -1329,8 +1344,42 @@ void Network::ProcessGameCommandQueue()
                 player->AddMoneySpent(cost);
             }
         }
-        game_command_queue.erase(game_command_queue.begin());
     }
+    log_verbose("Ran %u game commands for tick %u, %u still queued, %u ms average wait, %u ms longest wait",
+        (uint32)(tickEnd - game_command_queue_head), gCurrentTicks, (uint32)(game_command_queue.size() - tickEnd),
+        (uint32)(game_command_latency_total / game_commands_processed), game_command_latency_max);
+
+    game_command_queue_head = tickEnd;
+    if (game_command_queue_head == game_command_queue.size()) {
+        game_command_queue.clear();
+        game_command_queue_head = 0;
+    } else if (game_command_queue_head > game_command_queue.size() / 2) {
+        game_command_queue.erase(game_command_queue.begin(), game_command_queue.begin() + game_command_queue_head);
+        game_command_queue_head = 0;
+    }
+}
+
+void Network::EnqueueGameCommand(const GameCommand &gc)
+{
+    // Commands nearly always arrive in tick order, otherwise insert after any with the same tick
+    if (game_command_queue.size() == game_command_queue_head || !(gc < game_command_queue.back())) {
+        game_command_queue.push_back(gc);
+    } else {
+        auto it = std::upper_bound(game_command_queue.begin() + game_command_queue_head, game_command_queue.end(), gc);
+        game_command_queue.insert(it, gc);
+    }
+
+    size_t depth = game_command_queue.size() - game_command_queue_head;
+    if (depth > game_command_queue_max_depth) {
+        game_command_queue_max_depth = depth;
+        log_verbose("Game command queue reached a depth of %u", (uint32)depth);
+    }
+}
+
+void Network::ClearGameCommandQueue()
+{
+    game_command_queue.clear();
+    game_command_queue_head = 0;
 }
 
 void Network::AddClient(ITcpSocket * socket)
@@ -1772,7 +1821,7 @@ void Network::Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& pa
         if (LoadMap(&ms))
         {
             game_load_init();
-            game_command_queue.clear();
+            ClearGameCommandQueue();
             server_tick = gCurrentTicks;
             server_srand0_tick = 0;
             // window_network_status_open("Loaded new map from network");
@@ -1811,6 +1860,7 @@ bool Network::LoadMap(IStream * stream)
 
         // Read other data not in normal save files
         stream->Read(gSpriteSpatialIndex, 0x10001 * sizeof(uint16));
+        reset_vehicle_spatial_index();
         gGamePaused = stream->ReadValue<uint32>();
         _guestGenerationProbability = stream->ReadValue<uint32>();
         _suggestedGuestMaximum = stream->ReadValue<uint32>();
@@ -1844,7 +1894,7 @@ bool Network::LoadMap(IStream * stream)
     return result;
 }
 
-bool Network::SaveMap(IStream * stream, const std::vector<const ObjectRepositoryItem *> &objects) const
+bool Network::SaveMap(IStream * stream, const std::vector<const ObjectRepositoryItem *> &objects)
 {
     bool result = false;
     viewport_set_saved_view();
@@ -1922,7 +1972,7 @@ void Network::Client_Handle_GAMECMD(NetworkConnection& connection, NetworkPacket
     packet >> tick >> args[0] >> args[1] >> args[2] >> args[3] >> args[4] >> args[5] >> args[6] >> playerid >> callback;
 
     GameCommand gc = GameCommand(tick, args, playerid, callback);
-    game_command_queue.insert(gc);
+    EnqueueGameCommand(gc);
 }
 
 void Network::Server_Handle_GAMECMD(NetworkConnection& connection, NetworkPacket& packet)
@@ -63,7 +63,6 @@ extern "C" {
 
 #include <array>
 #include <list>
-#include <set>
 #include <memory>
 #include <string>
 #include <vector>
@@ -171,6 +170,10 @@ public:
     std::string ServerProviderEmail;
     std::string ServerProviderWebsite;
 
+    // The park plus the state that is not in saved games, also used for replay snapshots
+    static bool LoadMap(IStream * stream);
+    static bool SaveMap(IStream * stream, const std::vector<const ObjectRepositoryItem *> &objects);
+
 private:
     bool ProcessConnection(NetworkConnection& connection);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
@@ -184,24 +187,27 @@ private:
     std::string GenerateAdvertiseKey();
     void SetupDefaultGroups();
 
-    bool LoadMap(IStream * stream);
-    bool SaveMap(IStream * stream, const std::vector<const ObjectRepositoryItem *> &objects) const;
 
     struct GameCommand
     {
         GameCommand(uint32 t, uint32* args, uint8 p, uint8 cb) {
             tick = t; eax = args[0]; ebx = args[1]; ecx = args[2]; edx = args[3];
             esi = args[4]; edi = args[5]; ebp = args[6]; playerid = p; callback = cb;
+            receivedTime = platform_get_ticks();
         }
         uint32 tick;
         uint32 eax, ebx, ecx, edx, esi, edi, ebp;
         uint8 playerid;
         uint8 callback;
+        uint32 receivedTime;
         bool operator<(const GameCommand& comp) const {
             return tick < comp.tick;
         }
     };
 
+    void EnqueueGameCommand(const GameCommand &gc);
+    void ClearGameCommandQueue();
+
     sint32 mode = NETWORK_MODE_NONE;
     sint32 status = NETWORK_STATUS_NONE;
     bool _closeLock = false;
@@ -219,7 +225,14 @@ private:
     char server_sprite_hash[EVP_MAX_MD_SIZE + 1];
     uint8 player_id = 0;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
-    std::multiset<GameCommand> game_command_queue;
+    // Sorted by tick and consumed from game_command_queue_head, the consumed commands are only erased
+    // once they make up most of the storage so it stays contiguous and is reused between ticks.
+    std::vector<GameCommand> game_command_queue;
+    size_t game_command_queue_head = 0;
+    size_t game_command_queue_max_depth = 0;
+    uint64 game_commands_processed = 0;
+    uint64 game_command_latency_total = 0;
+    uint32 game_command_latency_max = 0;
     std::vector<uint8> chunk_buffer;
     std::string _password;
     bool _desynchronised = false;
@@ -120,4 +120,7 @@ const rct_object_entry * object_list_find(rct_object_entry *entry);
 void object_entry_get_name(utf8 * buffer, size_t bufferSize, const rct_object_entry * entry);
 void object_entry_get_name_fixed(utf8 * buffer, size_t bufferSize, const rct_object_entry * entry);
 
+void object_image_table_touch(uint32 imageId);
+void object_image_table_evict_unused();
+
 #endif
@@ -50,13 +50,13 @@ void BannerObject::Load()
 {
     GetStringTable()->Sort();
     _legacyType.name = language_allocate_object_string(GetName());
-    _legacyType.image = gfx_object_allocate_images(GetImageTable()->GetImages(), GetImageTable()->GetCount());
+    _legacyType.image = GetImageTable()->Allocate();
 }
 
 void BannerObject::Unload()
 {
     language_free_object_string(_legacyType.name);
-    gfx_object_free_images(_legacyType.image, GetImageTable()->GetCount());
+    GetImageTable()->Free();
 
     _legacyType.name = 0;
     _legacyType.image = 0;
@@ -14,16 +14,43 @@
  *****************************************************************************/
 #pragma endregion
 
+#include <algorithm>
+#include <unordered_map>
 #include "../core/Console.hpp"
+#include "../core/FileStream.hpp"
 #include "../core/IStream.hpp"
+#include "../core/Math.hpp"
 #include "../core/Memory.hpp"
+#include "../core/String.hpp"
+#include "../OpenRCT2.h"
+#include "../rct12/SawyerChunkReader.h"
 #include "ImageTable.h"
 #include "Object.h"
 
+constexpr uint32 INVALID_IMAGE_ID = UINT32_MAX;
+
+// Amount of image data read on demand that is kept in memory before unused tables are evicted
+constexpr size_t MAX_LAZY_IMAGE_DATA_SIZE = 64 * 1024 * 1024;
+
+static std::vector<ImageTable *> _lazyImageTables;      // Indexed by image ID
+static std::list<ImageTable *>   _loadedLazyImageTables;    // Least recently drawn first
+static size_t                    _loadedLazyImageDataSize = 0;
+static uint32                    _currentFrame = 0;
+
+// Decoded object files, shared by the loaded image tables read from the same file
+static std::unordered_map<std::string, std::weak_ptr<SawyerChunk>> _sourceChunks;
+
 ImageTable::~ImageTable()
 {
-    Memory::Free(_data);
-    _data = nullptr;
+    if (IsLazy())
+    {
+        UnloadData();
+    }
+    else
+    {
+        Memory::Free(_data);
+        _data = nullptr;
+    }
     _dataSize = 0;
 }
 
@@ -33,8 +60,17 @@ void ImageTable::Read(IReadObjectContext * context, IStream * stream)
     {
         uint32 numImages = stream->ReadValue<uint32>();
         uint32 imageDataSize = stream->ReadValue<uint32>();
+        _count = numImages;
 
         uint64 headerTableSize = numImages * 16;
+        if (gOpenRCT2NoGraphics)
+        {
+            // Only the number of images is needed to reserve the image IDs, skip the rest
+            uint64 tableSize = Math::Min<uint64>(headerTableSize + imageDataSize, stream->GetLength() - stream->GetPosition());
+            stream->Seek((sint64)tableSize, STREAM_SEEK_CURRENT);
+            return;
+        }
+
         uint64 remainingBytes = stream->GetLength() - stream->GetPosition() - headerTableSize;
         if (remainingBytes > imageDataSize)
         {
@@ -42,15 +78,22 @@ void ImageTable::Read(IReadObjectContext * context, IStream * stream)
             imageDataSize = (uint32)remainingBytes;
         }
 
+        // Objects read from a file only keep the image headers, the data is read again when first drawn
+        const utf8 * sourcePath = context->GetSourcePath();
+        bool lazy = !String::IsNullOrEmpty(sourcePath);
+
         _dataSize = imageDataSize;
-        _data = Memory::Reallocate(_data, _dataSize);
-        if (_data == nullptr)
+        if (!lazy)
         {
-            context->LogError(OBJECT_ERROR_BAD_IMAGE_TABLE, "Image table too large.");
-            throw Exception();
+            _data = Memory::Reallocate(_data, _dataSize);
+            if (_data == nullptr)
+            {
+                context->LogError(OBJECT_ERROR_BAD_IMAGE_TABLE, "Image table too large.");
+                throw Exception();
+            }
         }
 
-        // Read g1 element headers
+        // Read g1 element headers, lazy tables keep the offsets relative to the image data
         uintptr_t imageDataBase = (uintptr_t)_data;
         for (uint32 i = 0; i < numImages; i++)
         {
@@ -69,15 +112,29 @@ void ImageTable::Read(IReadObjectContext * context, IStream * stream)
             _entries.push_back(g1Element);
         }
 
-        // Read g1 element data
-        size_t readBytes = (size_t)stream->TryRead(_data, _dataSize);
+        size_t readBytes;
+        if (lazy)
+        {
+            _sourcePath = sourcePath;
+            _dataOffset = (size_t)stream->GetPosition();
+            readBytes = (size_t)Math::Min<uint64>(_dataSize, stream->GetLength() - stream->GetPosition());
+            stream->Seek(readBytes, STREAM_SEEK_CURRENT);
+        }
+        else
+        {
+            // Read g1 element data
+            readBytes = (size_t)stream->TryRead(_data, _dataSize);
+        }
 
         // If data is shorter than expected (some custom objects are unfortunately like that)
         size_t unreadBytes = _dataSize - readBytes;
         if (unreadBytes > 0)
         {
-            void * ptr = (void*)(((uintptr_t)_data) + readBytes);
-            Memory::Set(ptr, 0, unreadBytes);
+            if (!lazy)
+            {
+                void * ptr = (void*)(((uintptr_t)_data) + readBytes);
+                Memory::Set(ptr, 0, unreadBytes);
+            }
 
             context->LogWarning(OBJECT_ERROR_BAD_IMAGE_TABLE, "Image table size shorter than expected.");
         }
@@ -90,3 +147,192 @@ void ImageTable::Read(IReadObjectContext * context, IStream * stream)
         throw;
     }
 }
+
+uint32 ImageTable::Allocate()
+{
+    if (!IsLazy())
+    {
+        _baseImageId = gfx_object_allocate_images(GetImages(), _count);
+        return _baseImageId;
+    }
+
+    // Only reserve the image IDs, the headers are set without any image data until first drawn
+    _baseImageId = gfx_object_allocate_images(nullptr, _count);
+    if (_baseImageId != INVALID_IMAGE_ID)
+    {
+        if (_lazyImageTables.size() < _baseImageId + _count)
+        {
+            _lazyImageTables.resize(_baseImageId + _count, nullptr);
+        }
+        std::fill_n(_lazyImageTables.begin() + _baseImageId, _count, this);
+        UpdateImageOffsets();
+    }
+    return _baseImageId;
+}
+
+void ImageTable::Free()
+{
+    if (_baseImageId == 0 || _baseImageId == INVALID_IMAGE_ID)
+    {
+        return;
+    }
+
+    if (IsLazy())
+    {
+        UnloadData();
+        std::fill_n(_lazyImageTables.begin() + _baseImageId, _count, nullptr);
+    }
+    gfx_object_free_images(_baseImageId, _count);
+    _baseImageId = 0;
+}
+
+void ImageTable::LoadData()
+{
+    if (_data != nullptr)
+    {
+        return;
+    }
+
+    try
+    {
+        std::shared_ptr<SawyerChunk> chunk = ReadSourceChunk();
+        if (chunk->GetLength() >= _dataOffset + _dataSize)
+        {
+            _sourceChunk = chunk;
+            _data = (void *)((uintptr_t)chunk->GetData() + _dataOffset);
+        }
+        else
+        {
+            // Image data shorter than expected is padded with zeros, which needs a copy of its own
+            size_t readBytes = chunk->GetLength() > _dataOffset ? chunk->GetLength() - _dataOffset : 0;
+            _data = Memory::Allocate<void>(Math::Max<size_t>(_dataSize, 1));
+            Memory::Copy(_data, (const void *)((uintptr_t)chunk->GetData() + _dataOffset), readBytes);
+            Memory::Set((void *)((uintptr_t)_data + readBytes), 0, _dataSize - readBytes);
+        }
+    }
+    catch (const Exception &)
+    {
+        // Draw the images as empty rather than retrying every frame
+        Console::Error::WriteLine("Unable to read images from '%s'", _sourcePath.c_str());
+        _data = Memory::Allocate<void>(Math::Max<size_t>(_dataSize, 1));
+        Memory::Set(_data, 0, _dataSize);
+    }
+
+    _loadedPosition = _loadedLazyImageTables.insert(_loadedLazyImageTables.end(), this);
+    _loadedLazyImageDataSize += _dataSize;
+    UpdateImageOffsets();
+}
+
+void ImageTable::UnloadData()
+{
+    if (_data == nullptr)
+    {
+        return;
+    }
+
+    _loadedLazyImageTables.erase(_loadedPosition);
+    _loadedLazyImageDataSize -= _dataSize;
+
+    if (_sourceChunk != nullptr)
+    {
+        _sourceChunk = nullptr;
+        auto sourceIt = _sourceChunks.find(_sourcePath);
+        if (sourceIt != _sourceChunks.end() && sourceIt->second.expired())
+        {
+            _sourceChunks.erase(sourceIt);
+        }
+    }
+    else
+    {
+        Memory::Free(_data);
+    }
+    _data = nullptr;
+    UpdateImageOffsets();
+}
+
+void ImageTable::Touch(uint32 frame)
+{
+    if (_data == nullptr)
+    {
+        _lastUsedFrame = frame;
+        LoadData();
+    }
+    else if (_lastUsedFrame != frame)
+    {
+        // Keep the loaded tables ordered by when they were last drawn
+        _lastUsedFrame = frame;
+        _loadedLazyImageTables.splice(_loadedLazyImageTables.end(), _loadedLazyImageTables, _loadedPosition);
+    }
+}
+
+/**
+ * Decodes the object file the image data is read from, or returns the decoded file if another loaded image table
+ * was read from it.
+ */
+std::shared_ptr<SawyerChunk> ImageTable::ReadSourceChunk()
+{
+    auto sourceIt = _sourceChunks.find(_sourcePath);
+    if (sourceIt != _sourceChunks.end())
+    {
+        std::shared_ptr<SawyerChunk> chunk = sourceIt->second.lock();
+        if (chunk != nullptr)
+        {
+            return chunk;
+        }
+    }
+
+    auto fs = FileStream(_sourcePath, FILE_MODE_OPEN);
+    auto chunkReader = SawyerChunkReader(&fs);
+    fs.Seek(sizeof(rct_object_entry), STREAM_SEEK_CURRENT);
+    std::shared_ptr<SawyerChunk> chunk = chunkReader.ReadChunk();
+    _sourceChunks[_sourcePath] = chunk;
+    return chunk;
+}
+
+void ImageTable::UpdateImageOffsets()
+{
+    if (_baseImageId == 0 || _baseImageId == INVALID_IMAGE_ID)
+    {
+        return;
+    }
+
+    for (uint32 i = 0; i < _count; i++)
+    {
+        rct_g1_element g1Element = _entries[i];
+        g1Element.offset = _data == nullptr ? nullptr : (uint8*)((uintptr_t)_data + (uintptr_t)g1Element.offset);
+        g1Elements[_baseImageId + i] = g1Element;
+    }
+}
+
+extern "C"
+{
+    void object_image_table_touch(uint32 imageId)
+    {
+        if (imageId < _lazyImageTables.size())
+        {
+            ImageTable * imageTable = _lazyImageTables[imageId];
+            if (imageTable != nullptr)
+            {
+                imageTable->Touch(_currentFrame);
+            }
+        }
+    }
+
+    void object_image_table_evict_unused()
+    {
+        if (_loadedLazyImageDataSize > MAX_LAZY_IMAGE_DATA_SIZE)
+        {
+            // Evict the least recently drawn tables, but none that were drawn in the last frame
+            while (_loadedLazyImageDataSize > MAX_LAZY_IMAGE_DATA_SIZE)
+            {
+                ImageTable * imageTable = _loadedLazyImageTables.front();
+                if (imageTable->GetLastUsedFrame() == _currentFrame)
+                {
+                    break;
+                }
+                imageTable->UnloadData();
+            }
+        }
+        _currentFrame++;
+    }
+}
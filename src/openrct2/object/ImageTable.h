@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <list>
+#include <memory>
+#include <string>
 #include <vector>
 #include "../common.h"
 
@@ -26,18 +29,55 @@ extern "C"
 
 interface IReadObjectContext;
 interface IStream;
+class SawyerChunk;
 
+/**
+ * The images of an object. For objects read from a file, only the image headers are read up front and
+ * the image data is read again from the file the first time one of the images is drawn. The decoded file is shared
+ * by all loaded tables read from it and freed with the last of them.
+ */
 class ImageTable
 {
 private:
     std::vector<rct_g1_element> _entries;
     void *                      _data       = nullptr;
     size_t                      _dataSize   = 0;
+    uint32                      _count      = 0;
+
+    // Where to read the image data from when it is not kept in memory
+    std::string                 _sourcePath;
+    std::shared_ptr<SawyerChunk> _sourceChunk;  // The decoded file _data points into, if loaded
+    size_t                      _dataOffset     = 0;
+    uint32                      _baseImageId    = 0;
+    uint32                      _lastUsedFrame  = 0;
+    std::list<ImageTable *>::iterator _loadedPosition;  // Position in the least recently used order, if loaded
 
 public:
     ~ImageTable();
 
     void                    Read(IReadObjectContext * context, IStream * stream);
-    const rct_g1_element *  GetImages() const { return _entries.data(); }
-    uint32                  GetCount() const { return (uint32)_entries.size(); }
+    const rct_g1_element *  GetImages() const { return _entries.empty() ? nullptr : _entries.data(); }
+    uint32                  GetCount() const { return _count; }
+
+    /**
+     * Allocates image IDs for the images and returns the base image ID.
+     */
+    uint32                  Allocate();
+    void                    Free();
+
+    bool                    IsLazy() const { return !_sourcePath.empty(); }
+    bool                    IsDataLoaded() const { return _data != nullptr; }
+    size_t                  GetDataSize() const { return _dataSize; }
+    uint32                  GetLastUsedFrame() const { return _lastUsedFrame; }
+
+    /**
+     * Marks the images as drawn in the given frame, loading the image data if needed.
+     */
+    void                    Touch(uint32 frame);
+    void                    LoadData();
+    void                    UnloadData();
+
+private:
+    std::shared_ptr<SawyerChunk> ReadSourceChunk();
+    void                    UpdateImageOffsets();
 };
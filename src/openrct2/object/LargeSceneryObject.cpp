@@ -78,7 +78,7 @@ void LargeSceneryObject::Load()
 {
     GetStringTable()->Sort();
     _legacyType.name = language_allocate_object_string(GetName());
-    _baseImageId = gfx_object_allocate_images(GetImageTable()->GetImages(), GetImageTable()->GetCount());
+    _baseImageId = GetImageTable()->Allocate();
     _legacyType.image = _baseImageId;
 
     _legacyType.large_scenery.tiles = _tiles;
@@ -100,7 +100,7 @@ void LargeSceneryObject::Load()
 void LargeSceneryObject::Unload()
 {
     language_free_object_string(_legacyType.name);
-    gfx_object_free_images(_baseImageId, GetImageTable()->GetCount());
+    GetImageTable()->Free();
 
     _legacyType.name = 0;
     _legacyType.image = 0;
@@ -45,6 +45,11 @@ interface IReadObjectContext
 
     virtual void LogWarning(uint32 code, const utf8 * text) abstract;
     virtual void LogError(uint32 code, const utf8 * text) abstract;
+
+    /**
+     * Gets the path of the file the object is read from, or nullptr if it is read from memory.
+     */
+    virtual const utf8 * GetSourcePath() const abstract;
 };
 
 class Object
@@ -45,6 +45,7 @@ class ReadObjectContext : public IReadObjectContext
 {
 private:
     utf8 *  _objectName;
+    utf8 *  _sourcePath = nullptr;
     bool    _wasWarning = false;
     bool    _wasError = false;
 
@@ -52,15 +53,26 @@ public:
     bool WasWarning() const { return _wasWarning; }
     bool WasError() const { return _wasError; }
 
-    explicit ReadObjectContext(const utf8 * objectFileName)
+    explicit ReadObjectContext(const utf8 * objectFileName, const utf8 * sourcePath = nullptr)
     {
         _objectName = String::Duplicate(objectFileName);
+        if (sourcePath != nullptr)
+        {
+            _sourcePath = String::Duplicate(sourcePath);
+        }
     }
 
     ~ReadObjectContext() override
     {
         Memory::Free(_objectName);
+        Memory::Free(_sourcePath);
         _objectName = nullptr;
+        _sourcePath = nullptr;
+    }
+
+    const utf8 * GetSourcePath() const override
+    {
+        return _sourcePath;
     }
 
     void LogWarning(uint32 code, const utf8 * text) override
@@ -124,7 +136,7 @@ namespace ObjectFactory
             log_verbose("  size: %zu", chunk->GetLength());
 
             auto chunkStream = MemoryStream(chunk->GetData(), chunk->GetLength());
-            auto readContext = ReadObjectContext(objectName);
+            auto readContext = ReadObjectContext(objectName, path);
             ReadObjectLegacy(result, &readContext, &chunkStream);
             if (readContext.WasError())
             {
@@ -14,9 +14,14 @@
  *****************************************************************************/
 #pragma endregion
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "../core/Console.hpp"
 #include "../core/Memory.hpp"
 #include "FootpathItemObject.h"
@@ -470,6 +475,25 @@ private:
 
     Object * * LoadObjects(const ObjectRepositoryItem * * requiredObjects, size_t * outNewObjectsLoaded)
     {
+        // Gather the objects that are not loaded yet, the same object may be required by multiple slots
+        auto itemsToLoad = std::vector<const ObjectRepositoryItem *>();
+        auto itemsToLoadIndex = std::unordered_map<const ObjectRepositoryItem *, size_t>();
+        for (sint32 i = 0; i < OBJECT_ENTRY_COUNT; i++)
+        {
+            const ObjectRepositoryItem * ori = requiredObjects[i];
+            if (ori != nullptr && ori->LoadedObject == nullptr)
+            {
+                if (itemsToLoadIndex.emplace(ori, itemsToLoad.size()).second)
+                {
+                    itemsToLoad.push_back(ori);
+                }
+            }
+        }
+
+        // Read and parse the object files on worker threads
+        std::vector<Object *> newObjects = ReadObjects(itemsToLoad);
+
+        // Load and register the new objects on this thread, in slot order
         size_t newObjectsLoaded = 0;
         Object * * loadedObjects = Memory::AllocateArray<Object *>(OBJECT_ENTRY_COUNT);
         for (sint32 i = 0; i < OBJECT_ENTRY_COUNT; i++)
@@ -481,13 +505,18 @@ private:
                 loadedObject = ori->LoadedObject;
                 if (loadedObject == nullptr)
                 {
-                    loadedObject = GetOrLoadObject(ori);
+                    loadedObject = newObjects[itemsToLoadIndex[ori]];
                     if (loadedObject == nullptr)
                     {
                         ReportObjectLoadProblem(&ori->ObjectEntry);
+                        DeleteUnregisteredObjects(itemsToLoad, newObjects);
                         Memory::Free(loadedObjects);
                         return nullptr;
-                    } else {
+                    }
+                    else
+                    {
+                        loadedObject->Load();
+                        _objectRepository->RegisterLoadedObject(ori, loadedObject);
                         newObjectsLoaded++;
                     }
                 }
@@ -501,6 +530,56 @@ private:
         return loadedObjects;
     }
 
+    std::vector<Object *> ReadObjects(const std::vector<const ObjectRepositoryItem *> &items)
+    {
+        auto objects = std::vector<Object *>(items.size(), nullptr);
+
+        // Reading an object only touches its own file and the new object, so the items can be
+        // shared out between threads. Loading into the legacy tables is left to the caller.
+        size_t numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        numThreads = std::min(numThreads, items.size());
+        std::atomic<size_t> nextIndex(0);
+        auto worker = [this, &items, &objects, &nextIndex]() -> void
+        {
+            size_t index;
+            while ((index = nextIndex++) < items.size())
+            {
+                objects[index] = _objectRepository->LoadObject(items[index]);
+            }
+        };
+
+        if (numThreads <= 1)
+        {
+            worker();
+        }
+        else
+        {
+            auto threads = std::vector<std::thread>();
+            for (size_t i = 0; i < numThreads - 1; i++)
+            {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto &thread : threads)
+            {
+                thread.join();
+            }
+        }
+        return objects;
+    }
+
+    static void DeleteUnregisteredObjects(const std::vector<const ObjectRepositoryItem *> &items,
+                                          const std::vector<Object *> &objects)
+    {
+        for (size_t i = 0; i < items.size(); i++)
+        {
+            if (objects[i] != nullptr && items[i]->LoadedObject != objects[i])
+            {
+                delete objects[i];
+            }
+        }
+    }
+
     Object * GetOrLoadObject(const ObjectRepositoryItem * ori)
     {
         Object * loadedObject = ori->LoadedObject;
@@ -153,7 +153,7 @@ void RideObject::Load()
     GetStringTable()->Sort();
     _legacyType.name = language_allocate_object_string(GetName());
     _legacyType.description = language_allocate_object_string(GetDescription());
-    _legacyType.images_offset = gfx_object_allocate_images(GetImageTable()->GetImages(), GetImageTable()->GetCount());
+    _legacyType.images_offset = GetImageTable()->Allocate();
     _legacyType.vehicle_preset_list = &_presetColours;
 
     sint32 cur_vehicle_images_offset = _legacyType.images_offset + 3;
@@ -366,7 +366,7 @@ void RideObject::Unload()
 {
     language_free_object_string(_legacyType.name);
     language_free_object_string(_legacyType.description);
-    gfx_object_free_images(_legacyType.images_offset, GetImageTable()->GetCount());
+    GetImageTable()->Free();
 
     _legacyType.name = 0;
     _legacyType.description = 0;
@@ -76,7 +76,7 @@ void SmallSceneryObject::Load()
 {
     GetStringTable()->Sort();
     _legacyType.name = language_allocate_object_string(GetName());
-    _legacyType.image = gfx_object_allocate_images(GetImageTable()->GetImages(), GetImageTable()->GetCount());
+    _legacyType.image = GetImageTable()->Allocate();
 
     _legacyType.small_scenery.scenery_tab_id = 0xFF;
 
@@ -89,7 +89,7 @@ void SmallSceneryObject::Load()
 void SmallSceneryObject::Unload()
 {
     language_free_object_string(_legacyType.name);
-    gfx_object_free_images(_legacyType.image, GetImageTable()->GetCount());
+    GetImageTable()->Free();
 
     _legacyType.name = 0;
     _legacyType.image = 0;
@@ -111,6 +111,7 @@ void banner_paint(uint8 direction, sint32 height, rct_map_element* map_element)
     gCurrentFontSpriteBase = FONT_SPRITE_BASE_TINY;
 
     uint16 string_width = gfx_get_string_width(gCommonStringFormatBuffer);
+    paint_tile_cache_set_dynamic();
     uint16 scroll = (gCurrentTicks / 2) % string_width;
 
     sub_98199C(scrolling_text_setup(string_id, scroll, scrollingMode), 0, 0, 1, 1, 0x15, height + 22, boundBoxOffsetX, boundBoxOffsetY, boundBoxOffsetZ, get_current_rotation());
@@ -141,6 +141,7 @@ void fence_paint(uint8 direction, sint32 height, rct_map_element * map_element)
     uint32 frameNum = 0;
 
     if (sceneryEntry->wall.flags2 & WALL_SCENERY_2_FLAG5) {
+        paint_tile_cache_set_dynamic();
         frameNum = (gCurrentTicks & 7) * 2;
     }
 
@@ -380,6 +381,7 @@ void fence_paint(uint8 direction, sint32 height, rct_map_element * map_element)
     gCurrentFontSpriteBase = FONT_SPRITE_BASE_TINY;
 
     uint16 string_width = gfx_get_string_width(signString);
+    paint_tile_cache_set_dynamic();
     uint16 scroll = (gCurrentTicks / 2) % string_width;
 
     sub_98199C(scrolling_text_setup(stringId, scroll, scrollingMode), 0, 0, 1, 1, 13, height + 8, boundsOffset.x, boundsOffset.y, boundsOffset.z, get_current_rotation());
@@ -246,6 +246,14 @@ static void sub_68B3FB(sint32 x, sint32 y)
     gUnk9DE568 = x;
     gUnk9DE56C = y;
     gDidPassSurface = false;
+
+    // The support height overlay needs the support state left behind by painting the elements
+    if (!gShowSupportSegmentHeights && g141E9DB == 0 &&
+        paint_tile_cache_begin(gPaintMapPosition.x >> 5, gPaintMapPosition.y >> 5, map_element)
+    ) {
+        return;
+    }
+
     do {
         // Only paint map_elements below the clip height.
         if ((gCurrentViewportFlags & VIEWPORT_FLAG_PAINT_CLIP_TO_HEIGHT) && (map_element->base_height > gClipHeight)) break;
@@ -271,6 +279,8 @@ static void sub_68B3FB(sint32 x, sint32 y)
             scenery_paint(direction, height, map_element);
             break;
         case MAP_ELEMENT_TYPE_ENTRANCE:
+            // Entrances show the ride status and scrolling signs
+            paint_tile_cache_set_dynamic();
             entrance_paint(direction, height, map_element);
             break;
         case MAP_ELEMENT_TYPE_WALL:
@@ -284,17 +294,22 @@ static void sub_68B3FB(sint32 x, sint32 y)
             break;
         // A corrupt element inserted by OpenRCT2 itself, which skips the drawing of the next element only.
         case MAP_ELEMENT_TYPE_CORRUPT:
-            if (map_element_is_last_for_tile(map_element))
+            if (map_element_is_last_for_tile(map_element)) {
+                paint_tile_cache_end();
                 return;
+            }
             map_element++;
             break;
         default:
             // An undefined map element is most likely a corrupt element inserted by 8 cars' MOM feature to skip drawing of all elements after it.
+            paint_tile_cache_end();
             return;
         }
         gPaintMapPosition = dword_9DE574;
     } while (!map_element_is_last_for_tile(map_element++));
 
+    paint_tile_cache_end();
+
     if (!gShowSupportSegmentHeights) {
         return;
     }
@@ -414,6 +414,7 @@ static void sub_6A4101(rct_map_element * map_element, uint16 height, uint32 ebp,
             gCurrentFontSpriteBase = FONT_SPRITE_BASE_TINY;
 
             uint16 string_width = gfx_get_string_width(gCommonStringFormatBuffer);
+            paint_tile_cache_set_dynamic();
             uint16 scroll = (gCurrentTicks / 2) % string_width;
 
             sub_98199C(scrolling_text_setup(string_id, scroll, scrollingMode), 0, 0, 1, 1, 21, height + 7,  boundBoxOffsets.x,  boundBoxOffsets.y,  boundBoxOffsets.z, get_current_rotation());
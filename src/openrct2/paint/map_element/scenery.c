@@ -140,6 +140,7 @@ void scenery_paint(uint8 direction, sint32 height, rct_map_element* mapElement)
     }
 
     if (entry->small_scenery.flags & SMALL_SCENERY_FLAG_ANIMATED) {
+        paint_tile_cache_set_dynamic();
         rct_drawpixelinfo* dpi = unk_140E9A8;
         if ( (entry->small_scenery.flags & SMALL_SCENERY_FLAG21) || (dpi->zoom_level <= 1) ) {
             // 6E01A9:
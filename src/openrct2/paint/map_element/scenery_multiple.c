@@ -363,6 +363,7 @@ void scenery_multiple_paint(uint8 direction, uint16 height, rct_map_element *map
     gCurrentFontSpriteBase = FONT_SPRITE_BASE_TINY;
 
     uint16 string_width = gfx_get_string_width(signString);
+    paint_tile_cache_set_dynamic();
     uint16 scroll = (gCurrentTicks / 2) % string_width;
     sub_98199C(scrolling_text_setup(stringId, scroll, scrollMode), 0, 0, 1, 1, 21, height + 25, boxoffset.x, boxoffset.y, boxoffset.z, get_current_rotation());
 
@@ -1144,6 +1144,8 @@ void surface_paint(uint8 direction, uint16 height, rct_map_element * mapElement)
 // Draw Staff Patrol Areas
     // loc_660D02
     if (gStaffDrawPatrolAreas != 0xFFFF) {
+        // Hiring or firing staff changes the shared patrol areas without invalidating their tiles
+        paint_tile_cache_set_dynamic();
         sint32 staffIndex = gStaffDrawPatrolAreas;
         bool is_staff_list = staffIndex & 0x8000;
         uint8 staffType = staffIndex & 0x7FFF;
@@ -15,10 +15,18 @@
 #pragma endregion
 
 #include "paint.h"
+#include "paint_sort.h"
+#include "../cheats.h"
 #include "../drawing/drawing.h"
 #include "../localisation/localisation.h"
 #include "../config/Config.h"
 #include "../interface/viewport.h"
+#include "../peep/staff.h"
+#include "../rct2.h"
+#include "../ride/track_design.h"
+#include "../ride/track_paint.h"
+#include "../world/map.h"
+#include "../world/park.h"
 #include "map_element/map_element.h"
 #include "sprite/sprite.h"
 #include "supports.h"
@@ -38,9 +46,127 @@ paint_string_struct * gPaintPSStringHead;
 static paint_string_struct * _paintLastPSString;
 
 #define MAX_PAINT_QUADRANTS (512)
+#define PAINT_ARENA_CHUNK_SIZE (4000)
+
+// Extra chunks of paint entries used once gPaintStructs is full, kept between frames
+static paint_entry * * _paintArenaChunks = NULL;
+static uint32 _paintArenaNumChunks = 0;
+static uint32 _paintArenaCurrentChunk = 0;
+
+#define PAINT_TILE_CACHE_MAX_SIZE (32 * 1024 * 1024)
+#define PAINT_TILE_CACHE_NO_ELEMENT 0xFFFF
+
+enum {
+    PAINT_TILE_CACHE_OP_QUADRANT,       // sub_98196C, sub_98197C
+    PAINT_TILE_CACHE_OP_PREPENDED,      // sub_98198C, linked to gWoodenSupportsPrependTo by the supports code
+    PAINT_TILE_CACHE_OP_CHAIN,          // sub_98199C following g_ps_F1AD28
+    PAINT_TILE_CACHE_OP_ATTACH,         // paint_attach_to_previous_ps
+    PAINT_TILE_CACHE_OP_APPEND,         // paint_attach_to_previous_attach following g_aps_F1AD2C
+    PAINT_TILE_CACHE_OP_SET_PS,         // g_ps_F1AD28 assigned by the paint code itself
+    PAINT_TILE_CACHE_OP_SET_PREPEND,    // gWoodenSupportsPrependTo assigned by the paint code itself
+};
+
+enum {
+    PAINT_TILE_CACHE_SOURCE_NULL,
+    PAINT_TILE_CACHE_SOURCE_OP,         // the paint struct created by an op
+    PAINT_TILE_CACHE_SOURCE_STATE,      // the value the same global had after an op
+};
+
+enum {
+    PAINT_TILE_CACHE_START_PS = 1 << 0,
+    PAINT_TILE_CACHE_START_APS = 1 << 1,
+    PAINT_TILE_CACHE_START_PREPEND = 1 << 2,
+};
+
+/**
+ * A paint call made while painting a tile. The paint struct is recorded without culling so the
+ * same ops can be replayed for any dpi, culling against the stored sprite bounds instead.
+ */
+typedef struct paint_tile_cache_op {
+    paint_entry entry;
+    sint32 left;
+    sint32 top;
+    sint32 right;
+    sint32 bottom;
+    sint32 positionHash;
+    uint16 mapElementIndex;
+    uint16 source;
+    uint8 kind;
+    uint8 sourceType;
+} paint_tile_cache_op;
+
+typedef struct paint_tile_cache_key {
+    uint32 generation;
+    uint32 viewFlags;
+    uint8 rotation;
+    uint8 zoom;
+    uint8 clipHeight;
+    uint8 startState;
+} paint_tile_cache_key;
+
+typedef struct paint_tile_cache_entry {
+    paint_tile_cache_key key;
+    bool dynamic;
+    uint32 numOps;
+    size_t size;
+    paint_tile_cache_op * ops;
+} paint_tile_cache_entry;
+
+/** The paint globals after an op, index 0 being the start of the tile. */
+typedef struct paint_tile_cache_state {
+    paint_entry * entry;
+    paint_struct * ps;
+    attached_paint_struct * aps;
+    paint_struct * prependTo;
+} paint_tile_cache_state;
+
+/** Globals read by the map element paint code that are not covered by tile invalidation. */
+typedef struct paint_tile_cache_globals {
+    rct_xy16 mapSelectionTiles[300];
+    rct2_peep_spawn peepSpawns[MAX_PEEP_SPAWNS];
+    rct_xy16 mapSelectPositionA;
+    rct_xy16 mapSelectPositionB;
+    rct_xyz16 mapSelectArrowPosition;
+    uint32 parkFlags;
+    uint16 mapSelectFlags;
+    uint16 mapSelectType;
+    uint16 staffDrawPatrolAreas;
+    sint16 mapBaseZ;
+    uint8 mapSelectArrowDirection;
+    uint8 screenFlags;
+    bool cheatsSandboxMode;
+    bool useOriginalRidePaint;
+} paint_tile_cache_globals;
+
+static paint_tile_cache_entry * _paintTileCache[MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL];
+static size_t _paintTileCacheSize = 0;
+static uint32 _paintTileCacheGeneration = 0;
+static paint_tile_cache_globals _paintTileCacheGlobals;
+
+// Ops and states of the tile being recorded or replayed
+static paint_tile_cache_op * _paintTileCacheOps = NULL;
+static paint_tile_cache_state * _paintTileCacheStates = NULL;
+static size_t _paintTileCacheCapacity = 0;
+static size_t _paintTileCacheNumOps = 0;
+
+static bool _paintTileCacheRecording = false;
+static bool _paintTileCacheDynamic;
+static sint32 _paintTileCacheIndex;
+static paint_tile_cache_key _paintTileCacheKey;
+static rct_map_element * _paintTileCacheFirstElement;
+static paint_tile_cache_state _paintTileCacheStart;
+static paint_entry * _paintTileCacheArenaNext;
+static paint_entry * _paintTileCacheArenaEnd;
+static uint32 _paintTileCacheArenaChunk;
+static sint32 _paintTileCacheBounds[4];
+
+// Stand-ins for paint structs of earlier tiles while recording
+static paint_struct _paintTileCacheStartPs;
+static attached_paint_struct _paintTileCacheStartAps;
+static paint_struct _paintTileCacheStartPrependTo;
 
 #ifdef NO_RCT2
-paint_entry gPaintStructs[4000];
+paint_entry gPaintStructs[PAINT_ARENA_CHUNK_SIZE];
 static uint32 _paintQuadrantBackIndex;
 static uint32 _paintQuadrantFrontIndex;
 static paint_struct *_paintQuadrants[MAX_PAINT_QUADRANTS];
@@ -76,11 +202,13 @@ static const uint8 BoundBoxDebugColours[] = {
 };
 
 bool gPaintBoundingBoxes;
+bool gPaintTileCacheEnabled = true;
 
 static void paint_attached_ps(rct_drawpixelinfo * dpi, paint_struct * ps, uint32 viewFlags);
 static void paint_ps_image_with_bounding_boxes(rct_drawpixelinfo * dpi, paint_struct * ps, uint32 imageId, sint16 x, sint16 y);
 static void paint_ps_image(rct_drawpixelinfo * dpi, paint_struct * ps, uint32 imageId, sint16 x, sint16 y);
 static uint32 paint_ps_colourify_image(uint32 imageId, uint8 spriteType, uint32 viewFlags);
+static void paint_tile_cache_check_globals();
 
 /**
  *
@@ -89,8 +217,9 @@ static uint32 paint_ps_colourify_image(uint32 imageId, uint8 spriteType, uint32
 void paint_init(rct_drawpixelinfo * dpi)
 {
     unk_140E9A8 = dpi;
-    gEndOfPaintStructArray = &gPaintStructs[4000 - 1];
+    gEndOfPaintStructArray = &gPaintStructs[PAINT_ARENA_CHUNK_SIZE - 1];
     gNextFreePaintStruct = gPaintStructs;
+    _paintArenaCurrentChunk = 0;
     g_ps_F1AD28 = NULL;
     g_aps_F1AD2C = NULL;
     for (sint32 i = 0; i < 512; i++) {
@@ -101,6 +230,46 @@ void paint_init(rct_drawpixelinfo * dpi)
     gPaintPSStringHead = NULL;
     _paintLastPSString = NULL;
     gWoodenSupportsPrependTo = NULL;
+
+    paint_tile_cache_check_globals();
+}
+
+/**
+ * Moves gNextFreePaintStruct on to the next chunk of the paint arena, allocating a new chunk if
+ * all existing ones are used. Paint structs are linked by pointer so they need not be contiguous.
+ */
+static bool paint_arena_next_chunk()
+{
+    if (_paintArenaCurrentChunk >= _paintArenaNumChunks) {
+        paint_entry * * newChunks = realloc(_paintArenaChunks, (_paintArenaNumChunks + 1) * sizeof(paint_entry *));
+        if (newChunks == NULL) {
+            return false;
+        }
+        _paintArenaChunks = newChunks;
+
+        paint_entry * chunk = malloc(PAINT_ARENA_CHUNK_SIZE * sizeof(paint_entry));
+        if (chunk == NULL) {
+            return false;
+        }
+        _paintArenaChunks[_paintArenaNumChunks++] = chunk;
+        log_verbose("Paint arena grown to %u entries", (_paintArenaNumChunks + 1) * PAINT_ARENA_CHUNK_SIZE);
+    }
+
+    paint_entry * chunk = _paintArenaChunks[_paintArenaCurrentChunk++];
+    gNextFreePaintStruct = chunk;
+    gEndOfPaintStructArray = &chunk[PAINT_ARENA_CHUNK_SIZE - 1];
+    return true;
+}
+
+/**
+ * Ensures gNextFreePaintStruct points to a free paint entry, only fails if memory runs out.
+ */
+static bool paint_reserve_entry()
+{
+    if (gNextFreePaintStruct < gEndOfPaintStructArray) {
+        return true;
+    }
+    return paint_arena_next_chunk();
 }
 
 static void paint_add_ps_to_quadrant(paint_struct * ps, sint32 positionHash)
@@ -115,12 +284,489 @@ static void paint_add_ps_to_quadrant(paint_struct * ps, sint32 positionHash)
     _paintQuadrantFrontIndex = max(_paintQuadrantFrontIndex, paintQuadrantIndex);
 }
 
+/**
+ * Position hash used to pick the paint quadrant of structs created by sub_98197C.
+ */
+static sint32 paint_get_position_hash(const paint_struct * ps, uint32 rotation)
+{
+    rct_xy16 attach = {
+        .x = ps->bound_box_x,
+        .y = ps->bound_box_y
+    };
+
+    rotate_map_coordinates(&attach.x, &attach.y, rotation);
+    switch (rotation) {
+    case 0:
+        break;
+    case 1:
+    case 3:
+        attach.x += 0x2000;
+        break;
+    case 2:
+        attach.x += 0x4000;
+        break;
+    }
+
+    return attach.x + attach.y;
+}
+
+static bool paint_tile_cache_reserve(size_t numOps)
+{
+    if (numOps <= _paintTileCacheCapacity) {
+        return true;
+    }
+
+    size_t newCapacity = max(numOps, max(_paintTileCacheCapacity * 2, 64));
+    paint_tile_cache_op * newOps = realloc(_paintTileCacheOps, newCapacity * sizeof(paint_tile_cache_op));
+    if (newOps == NULL) {
+        return false;
+    }
+    _paintTileCacheOps = newOps;
+
+    paint_tile_cache_state * newStates = realloc(_paintTileCacheStates, (newCapacity + 1) * sizeof(paint_tile_cache_state));
+    if (newStates == NULL) {
+        return false;
+    }
+    _paintTileCacheStates = newStates;
+    _paintTileCacheCapacity = newCapacity;
+    return true;
+}
+
+static void paint_tile_cache_free_entry(sint32 index)
+{
+    paint_tile_cache_entry * entry = _paintTileCache[index];
+    if (entry != NULL) {
+        _paintTileCacheSize -= entry->size;
+        free(entry);
+        _paintTileCache[index] = NULL;
+    }
+}
+
+static void paint_tile_cache_clear()
+{
+    for (sint32 i = 0; i < MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL; i++) {
+        paint_tile_cache_free_entry(i);
+    }
+}
+
+/**
+ * Drops the cached paint structs of a tile and its neighbours, whose painting depends on it
+ * (e.g. surface edges and path connections).
+ */
+void paint_tile_cache_invalidate_tile(sint32 tileX, sint32 tileY)
+{
+    for (sint32 y = tileY - 1; y <= tileY + 1; y++) {
+        for (sint32 x = tileX - 1; x <= tileX + 1; x++) {
+            if (x >= 0 && y >= 0 && x < MAXIMUM_MAP_SIZE_TECHNICAL && y < MAXIMUM_MAP_SIZE_TECHNICAL) {
+                paint_tile_cache_free_entry(x + y * MAXIMUM_MAP_SIZE_TECHNICAL);
+            }
+        }
+    }
+}
+
+/**
+ * Marks every cached tile as stale, stale entries are replaced when the tile is next painted.
+ */
+void paint_tile_cache_invalidate_all()
+{
+    _paintTileCacheGeneration++;
+}
+
+/**
+ * Prevents the tile currently being painted from being cached, used by paint code that
+ * depends on the current tick or on ride and vehicle state.
+ */
+void paint_tile_cache_set_dynamic()
+{
+    _paintTileCacheDynamic = true;
+}
+
+static void paint_tile_cache_check_globals()
+{
+    paint_tile_cache_globals globals;
+    memset(&globals, 0, sizeof(globals));
+    memcpy(globals.mapSelectionTiles, gMapSelectionTiles, sizeof(globals.mapSelectionTiles));
+    memcpy(globals.peepSpawns, gPeepSpawns, sizeof(globals.peepSpawns));
+    globals.mapSelectPositionA = gMapSelectPositionA;
+    globals.mapSelectPositionB = gMapSelectPositionB;
+    globals.mapSelectArrowPosition = gMapSelectArrowPosition;
+    globals.parkFlags = gParkFlags;
+    globals.mapSelectFlags = gMapSelectFlags;
+    globals.mapSelectType = gMapSelectType;
+    globals.staffDrawPatrolAreas = gStaffDrawPatrolAreas;
+    globals.mapBaseZ = gMapBaseZ;
+    globals.mapSelectArrowDirection = gMapSelectArrowDirection;
+    globals.screenFlags = gScreenFlags;
+    globals.cheatsSandboxMode = gCheatsSandboxMode;
+    globals.useOriginalRidePaint = gUseOriginalRidePaint;
+
+    if (memcmp(&globals, &_paintTileCacheGlobals, sizeof(globals)) != 0) {
+        memcpy(&_paintTileCacheGlobals, &globals, sizeof(globals));
+        paint_tile_cache_invalidate_all();
+    }
+}
+
+static void paint_tile_cache_push_op(uint8 kind, paint_entry * entry, sint32 positionHash, uint8 sourceType, uint16 source)
+{
+    if (!paint_tile_cache_reserve(_paintTileCacheNumOps + 1)) {
+        _paintTileCacheDynamic = true;
+        return;
+    }
+
+    paint_tile_cache_op * op = &_paintTileCacheOps[_paintTileCacheNumOps];
+    op->left = _paintTileCacheBounds[0];
+    op->top = _paintTileCacheBounds[1];
+    op->right = _paintTileCacheBounds[2];
+    op->bottom = _paintTileCacheBounds[3];
+    op->positionHash = positionHash;
+    op->mapElementIndex = PAINT_TILE_CACHE_NO_ELEMENT;
+    op->source = source;
+    op->kind = kind;
+    op->sourceType = sourceType;
+
+    _paintTileCacheNumOps++;
+    paint_tile_cache_state * state = &_paintTileCacheStates[_paintTileCacheNumOps];
+    state->entry = entry;
+    state->ps = g_ps_F1AD28;
+    state->aps = g_aps_F1AD2C;
+    state->prependTo = gWoodenSupportsPrependTo;
+}
+
+/**
+ * Works out where a paint struct pointer assigned by the paint code came from: the value the same
+ * global had earlier in the tile (e.g. a backup being restored) or a struct returned by an op.
+ */
+static bool paint_tile_cache_find_source(paint_struct * value, bool isPrependTo, uint8 * sourceType, uint16 * source)
+{
+    if (value == NULL) {
+        *sourceType = PAINT_TILE_CACHE_SOURCE_NULL;
+        *source = 0;
+        return true;
+    }
+
+    for (sint32 i = (sint32)_paintTileCacheNumOps; i >= 0; i--) {
+        const paint_tile_cache_state * state = &_paintTileCacheStates[i];
+        if ((isPrependTo ? state->prependTo : state->ps) == value) {
+            *sourceType = PAINT_TILE_CACHE_SOURCE_STATE;
+            *source = i;
+            return true;
+        }
+    }
+
+    for (sint32 i = (sint32)_paintTileCacheNumOps - 1; i >= 0; i--) {
+        const paint_tile_cache_op * op = &_paintTileCacheOps[i];
+        const paint_entry * entry = _paintTileCacheStates[i + 1].entry;
+        if (op->kind <= PAINT_TILE_CACHE_OP_CHAIN && entry != NULL && &entry->basic == value) {
+            *sourceType = PAINT_TILE_CACHE_SOURCE_OP;
+            *source = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Records any assignment the paint code made to the paint globals since the last op.
+ */
+static void paint_tile_cache_sync()
+{
+    if (_paintTileCacheNumOps >= PAINT_TILE_CACHE_NO_ELEMENT) {
+        _paintTileCacheDynamic = true;
+        return;
+    }
+
+    const paint_tile_cache_state * last = &_paintTileCacheStates[_paintTileCacheNumOps];
+    paint_struct * lastPrependTo = last->prependTo;
+    bool psChanged = g_ps_F1AD28 != last->ps;
+    bool prependToChanged = gWoodenSupportsPrependTo != last->prependTo;
+    uint8 sourceType;
+    uint16 source;
+
+    if (g_aps_F1AD2C != last->aps) {
+        _paintTileCacheDynamic = true;
+    }
+    if (psChanged) {
+        if (paint_tile_cache_find_source(g_ps_F1AD28, false, &sourceType, &source)) {
+            paint_tile_cache_push_op(PAINT_TILE_CACHE_OP_SET_PS, NULL, 0, sourceType, source);
+            _paintTileCacheStates[_paintTileCacheNumOps].prependTo = lastPrependTo;
+        } else {
+            _paintTileCacheDynamic = true;
+        }
+    }
+    if (prependToChanged) {
+        if (paint_tile_cache_find_source(gWoodenSupportsPrependTo, true, &sourceType, &source)) {
+            paint_tile_cache_push_op(PAINT_TILE_CACHE_OP_SET_PREPEND, NULL, 0, sourceType, source);
+        } else {
+            _paintTileCacheDynamic = true;
+        }
+    }
+}
+
+static void paint_tile_cache_record(uint8 kind, paint_entry * entry, sint32 positionHash)
+{
+    paint_tile_cache_push_op(kind, entry, positionHash, PAINT_TILE_CACHE_SOURCE_NULL, 0);
+}
+
+static paint_struct * paint_tile_cache_resolve(const paint_tile_cache_op * op, bool isPrependTo)
+{
+    const paint_tile_cache_state * state;
+    switch (op->sourceType) {
+    case PAINT_TILE_CACHE_SOURCE_OP:
+        state = &_paintTileCacheStates[op->source + 1];
+        return state->entry == NULL ? NULL : &state->entry->basic;
+    case PAINT_TILE_CACHE_SOURCE_STATE:
+        state = &_paintTileCacheStates[op->source];
+        return isPrependTo ? state->prependTo : state->ps;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Replays recorded ops, culling against the current dpi and linking the structs the same way
+ * sub_98196C and friends would have for the current paint globals.
+ * @param firstElement the first element of the tile to relocate element pointers to, NULL to keep them.
+ */
+static void paint_tile_cache_replay(const paint_tile_cache_op * ops, size_t numOps, rct_map_element * firstElement)
+{
+    rct_drawpixelinfo * dpi = unk_140E9A8;
+    paint_tile_cache_state * states = _paintTileCacheStates;
+
+    states[0].entry = NULL;
+    states[0].ps = g_ps_F1AD28;
+    states[0].aps = g_aps_F1AD2C;
+    states[0].prependTo = gWoodenSupportsPrependTo;
+
+    for (size_t i = 0; i < numOps; i++) {
+        const paint_tile_cache_op * op = &ops[i];
+        paint_entry * entry = NULL;
+
+        uint8 kind = op->kind;
+        if ((kind == PAINT_TILE_CACHE_OP_PREPENDED && gWoodenSupportsPrependTo == NULL) ||
+            (kind == PAINT_TILE_CACHE_OP_CHAIN && g_ps_F1AD28 == NULL)
+        ) {
+            kind = PAINT_TILE_CACHE_OP_QUADRANT;
+        } else if (kind == PAINT_TILE_CACHE_OP_APPEND && g_aps_F1AD2C == NULL) {
+            kind = PAINT_TILE_CACHE_OP_ATTACH;
+        }
+
+        bool visible =
+            op->right > dpi->x &&
+            op->top > dpi->y &&
+            op->left < dpi->x + dpi->width &&
+            op->bottom < dpi->y + dpi->height;
+
+        switch (kind) {
+        case PAINT_TILE_CACHE_OP_QUADRANT:
+        case PAINT_TILE_CACHE_OP_PREPENDED:
+            g_ps_F1AD28 = NULL;
+            g_aps_F1AD2C = NULL;
+            // fall through
+        case PAINT_TILE_CACHE_OP_CHAIN:
+            if (visible && paint_reserve_entry()) {
+                entry = gNextFreePaintStruct++;
+                paint_struct * ps = &entry->basic;
+                *ps = op->entry.basic;
+                ps->attached_ps = NULL;
+                ps->var_20 = NULL;
+                if (firstElement != NULL && op->mapElementIndex != PAINT_TILE_CACHE_NO_ELEMENT) {
+                    ps->mapElement = firstElement + op->mapElementIndex;
+                }
+
+                if (kind == PAINT_TILE_CACHE_OP_QUADRANT) {
+                    paint_add_ps_to_quadrant(ps, op->positionHash);
+                } else if (kind == PAINT_TILE_CACHE_OP_PREPENDED) {
+                    gWoodenSupportsPrependTo->var_20 = ps;
+                } else {
+                    g_ps_F1AD28->var_20 = ps;
+                }
+                g_ps_F1AD28 = ps;
+            }
+            break;
+        case PAINT_TILE_CACHE_OP_ATTACH:
+            if (g_ps_F1AD28 != NULL && paint_reserve_entry()) {
+                entry = gNextFreePaintStruct++;
+                attached_paint_struct * aps = &entry->attached;
+                *aps = op->entry.attached;
+                aps->next = g_ps_F1AD28->attached_ps;
+                g_ps_F1AD28->attached_ps = aps;
+                g_aps_F1AD2C = aps;
+            }
+            break;
+        case PAINT_TILE_CACHE_OP_APPEND:
+            if (paint_reserve_entry()) {
+                entry = gNextFreePaintStruct++;
+                attached_paint_struct * aps = &entry->attached;
+                *aps = op->entry.attached;
+                aps->next = NULL;
+                g_aps_F1AD2C->next = aps;
+                g_aps_F1AD2C = aps;
+            }
+            break;
+        case PAINT_TILE_CACHE_OP_SET_PS:
+            g_ps_F1AD28 = paint_tile_cache_resolve(op, false);
+            break;
+        case PAINT_TILE_CACHE_OP_SET_PREPEND:
+            gWoodenSupportsPrependTo = paint_tile_cache_resolve(op, true);
+            break;
+        }
+
+        paint_tile_cache_state * state = &states[i + 1];
+        state->entry = entry;
+        state->ps = g_ps_F1AD28;
+        state->aps = g_aps_F1AD2C;
+        state->prependTo = gWoodenSupportsPrependTo;
+    }
+}
+
+/**
+ * Paints the elements of a tile from the cache when it holds them for the current view.
+ * Otherwise starts recording the paint calls for the tile, which must be finished with
+ * paint_tile_cache_end once its elements have been painted.
+ * @return true if the tile was painted from the cache.
+ */
+bool paint_tile_cache_begin(sint32 tileX, sint32 tileY, rct_map_element * firstElement)
+{
+    if (!gPaintTileCacheEnabled || gTrackDesignSaveMode) {
+        return false;
+    }
+
+    paint_tile_cache_key key;
+    memset(&key, 0, sizeof(key));
+    key.generation = _paintTileCacheGeneration;
+    key.viewFlags = gCurrentViewportFlags;
+    key.rotation = get_current_rotation();
+    key.zoom = (uint8)unk_140E9A8->zoom_level;
+    key.clipHeight = gClipHeight;
+    if (g_ps_F1AD28 != NULL) key.startState |= PAINT_TILE_CACHE_START_PS;
+    if (g_aps_F1AD2C != NULL) key.startState |= PAINT_TILE_CACHE_START_APS;
+    if (gWoodenSupportsPrependTo != NULL) key.startState |= PAINT_TILE_CACHE_START_PREPEND;
+
+    sint32 index = tileX + tileY * MAXIMUM_MAP_SIZE_TECHNICAL;
+    paint_tile_cache_entry * entry = _paintTileCache[index];
+    if (entry != NULL && memcmp(&entry->key, &key, sizeof(key)) == 0) {
+        if (entry->dynamic || !paint_tile_cache_reserve(entry->numOps)) {
+            return false;
+        }
+        paint_tile_cache_replay(entry->ops, entry->numOps, firstElement);
+        return true;
+    }
+
+    if (!paint_tile_cache_reserve(64)) {
+        return false;
+    }
+
+    _paintTileCacheIndex = index;
+    _paintTileCacheKey = key;
+    _paintTileCacheFirstElement = firstElement;
+    _paintTileCacheArenaNext = gNextFreePaintStruct;
+    _paintTileCacheArenaEnd = gEndOfPaintStructArray;
+    _paintTileCacheArenaChunk = _paintArenaCurrentChunk;
+
+    _paintTileCacheStart.entry = NULL;
+    _paintTileCacheStart.ps = g_ps_F1AD28;
+    _paintTileCacheStart.aps = g_aps_F1AD2C;
+    _paintTileCacheStart.prependTo = gWoodenSupportsPrependTo;
+
+    // Structs of earlier tiles must not be modified while recording as the ops are replayed afterwards
+    memset(&_paintTileCacheStartPs, 0, sizeof(_paintTileCacheStartPs));
+    memset(&_paintTileCacheStartAps, 0, sizeof(_paintTileCacheStartAps));
+    memset(&_paintTileCacheStartPrependTo, 0, sizeof(_paintTileCacheStartPrependTo));
+    if (g_ps_F1AD28 != NULL) g_ps_F1AD28 = &_paintTileCacheStartPs;
+    if (g_aps_F1AD2C != NULL) g_aps_F1AD2C = &_paintTileCacheStartAps;
+    if (gWoodenSupportsPrependTo != NULL) gWoodenSupportsPrependTo = &_paintTileCacheStartPrependTo;
+
+    _paintTileCacheStates[0].entry = NULL;
+    _paintTileCacheStates[0].ps = g_ps_F1AD28;
+    _paintTileCacheStates[0].aps = g_aps_F1AD2C;
+    _paintTileCacheStates[0].prependTo = gWoodenSupportsPrependTo;
+    _paintTileCacheNumOps = 0;
+    _paintTileCacheDynamic = false;
+    _paintTileCacheRecording = true;
+    return false;
+}
+
+static void paint_tile_cache_store(size_t numOps, bool dynamic)
+{
+    if (dynamic) {
+        numOps = 0;
+    }
+
+    paint_tile_cache_free_entry(_paintTileCacheIndex);
+
+    size_t size = sizeof(paint_tile_cache_entry) + numOps * sizeof(paint_tile_cache_op);
+    if (_paintTileCacheSize + size > PAINT_TILE_CACHE_MAX_SIZE) {
+        paint_tile_cache_clear();
+    }
+
+    paint_tile_cache_entry * entry = malloc(size);
+    if (entry == NULL) {
+        return;
+    }
+    entry->key = _paintTileCacheKey;
+    entry->dynamic = dynamic;
+    entry->numOps = (uint32)numOps;
+    entry->size = size;
+    entry->ops = (paint_tile_cache_op *)(entry + 1);
+    memcpy(entry->ops, _paintTileCacheOps, numOps * sizeof(paint_tile_cache_op));
+
+    _paintTileCache[_paintTileCacheIndex] = entry;
+    _paintTileCacheSize += size;
+}
+
+/**
+ * Finishes recording the tile started by paint_tile_cache_begin, caches the recorded ops and
+ * replays them to create the paint structs for the current dpi.
+ */
+void paint_tile_cache_end()
+{
+    if (!_paintTileCacheRecording) {
+        return;
+    }
+    paint_tile_cache_sync();
+    _paintTileCacheRecording = false;
+
+    size_t numElements = 1;
+    for (const rct_map_element * element = _paintTileCacheFirstElement; !map_element_is_last_for_tile(element); element++) {
+        numElements++;
+    }
+
+    size_t numOps = _paintTileCacheNumOps;
+    for (size_t i = 0; i < numOps; i++) {
+        paint_tile_cache_op * op = &_paintTileCacheOps[i];
+        const paint_entry * entry = _paintTileCacheStates[i + 1].entry;
+        if (entry == NULL) {
+            continue;
+        }
+
+        op->entry = *entry;
+        if (op->kind <= PAINT_TILE_CACHE_OP_CHAIN && op->entry.basic.mapElement != NULL) {
+            ptrdiff_t elementIndex = op->entry.basic.mapElement - _paintTileCacheFirstElement;
+            if (elementIndex >= 0 && (size_t)elementIndex < numElements) {
+                op->mapElementIndex = (uint16)elementIndex;
+            } else {
+                _paintTileCacheDynamic = true;
+            }
+        }
+    }
+
+    gNextFreePaintStruct = _paintTileCacheArenaNext;
+    gEndOfPaintStructArray = _paintTileCacheArenaEnd;
+    _paintArenaCurrentChunk = _paintTileCacheArenaChunk;
+    g_ps_F1AD28 = _paintTileCacheStart.ps;
+    g_aps_F1AD2C = _paintTileCacheStart.aps;
+    gWoodenSupportsPrependTo = _paintTileCacheStart.prependTo;
+
+    paint_tile_cache_store(numOps, _paintTileCacheDynamic);
+    paint_tile_cache_replay(_paintTileCacheOps, numOps, NULL);
+}
+
 /**
  * Extracted from 0x0098196c, 0x0098197c, 0x0098198c, 0x0098199c
  */
 static paint_struct * sub_9819_c(uint32 image_id, rct_xyz16 offset, rct_xyz16 boundBoxSize, rct_xyz16 boundBoxOffset, uint8 rotation)
 {
-    if (gNextFreePaintStruct >= gEndOfPaintStructArray) return NULL;
+    if (!paint_reserve_entry()) return NULL;
     paint_struct * ps = &gNextFreePaintStruct->basic;
 
     ps->image_id = image_id;
@@ -158,10 +804,17 @@ static paint_struct * sub_9819_c(uint32 image_id, rct_xyz16 offset, rct_xyz16 bo
 
     rct_drawpixelinfo * dpi = unk_140E9A8;
 
-    if (right <= dpi->x)return NULL;
-    if (top <= dpi->y)return NULL;
-    if (left >= dpi->x + dpi->width)return NULL;
-    if (bottom >= dpi->y + dpi->height)return NULL;
+    if (_paintTileCacheRecording) {
+        _paintTileCacheBounds[0] = left;
+        _paintTileCacheBounds[1] = top;
+        _paintTileCacheBounds[2] = right;
+        _paintTileCacheBounds[3] = bottom;
+    } else {
+        if (right <= dpi->x)return NULL;
+        if (top <= dpi->y)return NULL;
+        if (left >= dpi->x + dpi->width)return NULL;
+        if (bottom >= dpi->y + dpi->height)return NULL;
+    }
 
 
     // This probably rotates the variables so they're relative to rotation 0.
@@ -229,10 +882,14 @@ paint_struct * sub_98196C(
     assert((uint16) bound_box_length_x == (sint16) bound_box_length_x);
     assert((uint16) bound_box_length_y == (sint16) bound_box_length_y);
 
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_sync();
+    }
+
     g_ps_F1AD28 = 0;
     g_aps_F1AD2C = NULL;
 
-    if (gNextFreePaintStruct >= gEndOfPaintStructArray) {
+    if (!paint_reserve_entry()) {
         return NULL;
     }
 
@@ -306,10 +963,17 @@ paint_struct * sub_98196C(
 
     rct_drawpixelinfo *dpi = unk_140E9A8;
 
-    if (right <= dpi->x) return NULL;
-    if (top <= dpi->y) return NULL;
-    if (left >= (dpi->x + dpi->width)) return NULL;
-    if (bottom >= (dpi->y + dpi->height)) return NULL;
+    if (_paintTileCacheRecording) {
+        _paintTileCacheBounds[0] = left;
+        _paintTileCacheBounds[1] = top;
+        _paintTileCacheBounds[2] = right;
+        _paintTileCacheBounds[3] = bottom;
+    } else {
+        if (right <= dpi->x) return NULL;
+        if (top <= dpi->y) return NULL;
+        if (left >= (dpi->x + dpi->width)) return NULL;
+        if (bottom >= (dpi->y + dpi->height)) return NULL;
+    }
 
     ps->flags = 0;
     ps->bound_box_x = coord_3d.x;
@@ -339,7 +1003,12 @@ paint_struct * sub_98196C(
         positionHash = coord_3d.x - coord_3d.y + 0x2000;
         break;
     }
-    paint_add_ps_to_quadrant(ps, positionHash);
+
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_record(PAINT_TILE_CACHE_OP_QUADRANT, gNextFreePaintStruct, positionHash);
+    } else {
+        paint_add_ps_to_quadrant(ps, positionHash);
+    }
 
     gNextFreePaintStruct++;
 
@@ -370,6 +1039,10 @@ paint_struct * sub_98197C(
     sint16 bound_box_offset_x, sint16 bound_box_offset_y, sint16 bound_box_offset_z,
     uint32 rotation
 ) {
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_sync();
+    }
+
     g_ps_F1AD28 = 0;
     g_aps_F1AD2C = NULL;
 
@@ -384,27 +1057,13 @@ paint_struct * sub_98197C(
 
     g_ps_F1AD28 = ps;
 
-    rct_xy16 attach = {
-        .x = ps->bound_box_x,
-        .y = ps->bound_box_y
-    };
-
-    rotate_map_coordinates(&attach.x, &attach.y, rotation);
-    switch (rotation) {
-    case 0:
-        break;
-    case 1:
-    case 3:
-        attach.x += 0x2000;
-        break;
-    case 2:
-        attach.x += 0x4000;
-        break;
+    sint32 positionHash = paint_get_position_hash(ps, rotation);
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_record(PAINT_TILE_CACHE_OP_QUADRANT, gNextFreePaintStruct, positionHash);
+    } else {
+        paint_add_ps_to_quadrant(ps, positionHash);
     }
 
-    sint32 positionHash = attach.x + attach.y;
-    paint_add_ps_to_quadrant(ps, positionHash);
-
     gNextFreePaintStruct++;
     return ps;
 }
@@ -437,6 +1096,10 @@ paint_struct * sub_98198C(
     assert((uint16) bound_box_length_x == (sint16) bound_box_length_x);
     assert((uint16) bound_box_length_y == (sint16) bound_box_length_y);
 
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_sync();
+    }
+
     g_ps_F1AD28 = 0;
     g_aps_F1AD2C = NULL;
 
@@ -450,6 +1113,9 @@ paint_struct * sub_98198C(
     }
 
     g_ps_F1AD28 = ps;
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_record(PAINT_TILE_CACHE_OP_PREPENDED, gNextFreePaintStruct, paint_get_position_hash(ps, rotation));
+    }
     gNextFreePaintStruct++;
     return ps;
 }
@@ -482,6 +1148,10 @@ paint_struct * sub_98199C(
     assert((uint16) bound_box_length_x == (sint16) bound_box_length_x);
     assert((uint16) bound_box_length_y == (sint16) bound_box_length_y);
 
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_sync();
+    }
+
     if (g_ps_F1AD28 == NULL) {
         return sub_98197C(
             image_id,
@@ -506,6 +1176,9 @@ paint_struct * sub_98199C(
     old_ps->var_20 = ps;
 
     g_ps_F1AD28 = ps;
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_record(PAINT_TILE_CACHE_OP_CHAIN, gNextFreePaintStruct, paint_get_position_hash(ps, rotation));
+    }
     gNextFreePaintStruct++;
     return ps;
 }
@@ -520,11 +1193,15 @@ paint_struct * sub_98199C(
  */
 bool paint_attach_to_previous_attach(uint32 image_id, uint16 x, uint16 y)
 {
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_sync();
+    }
+
     if (g_aps_F1AD2C == NULL) {
         return paint_attach_to_previous_ps(image_id, x, y);
     }
 
-    if (gNextFreePaintStruct >= gEndOfPaintStructArray) {
+    if (!paint_reserve_entry()) {
         return false;
     }
     attached_paint_struct * ps = &gNextFreePaintStruct->attached;
@@ -540,6 +1217,9 @@ bool paint_attach_to_previous_attach(uint32 image_id, uint16 x, uint16 y)
 
     g_aps_F1AD2C = ps;
 
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_record(PAINT_TILE_CACHE_OP_APPEND, gNextFreePaintStruct, 0);
+    }
     gNextFreePaintStruct++;
 
     return true;
@@ -555,7 +1235,11 @@ bool paint_attach_to_previous_attach(uint32 image_id, uint16 x, uint16 y)
  */
 bool paint_attach_to_previous_ps(uint32 image_id, uint16 x, uint16 y)
 {
-    if (gNextFreePaintStruct >= gEndOfPaintStructArray) {
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_sync();
+    }
+
+    if (!paint_reserve_entry()) {
         return false;
     }
     attached_paint_struct * ps = &gNextFreePaintStruct->attached;
@@ -570,8 +1254,6 @@ bool paint_attach_to_previous_ps(uint32 image_id, uint16 x, uint16 y)
         return false;
     }
 
-    gNextFreePaintStruct++;
-
     attached_paint_struct * oldFirstAttached = masterPs->attached_ps;
     masterPs->attached_ps = ps;
 
@@ -579,6 +1261,11 @@ bool paint_attach_to_previous_ps(uint32 image_id, uint16 x, uint16 y)
 
     g_aps_F1AD2C = ps;
 
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_record(PAINT_TILE_CACHE_OP_ATTACH, gNextFreePaintStruct, 0);
+    }
+    gNextFreePaintStruct++;
+
     return true;
 }
 
@@ -594,7 +1281,13 @@ bool paint_attach_to_previous_ps(uint32 image_id, uint16 x, uint16 y)
  */
 void paint_floating_money_effect(money32 amount, rct_string_id string_id, sint16 y, sint16 z, sint8 y_offsets[], sint16 offset_x, uint32 rotation)
 {
-    if (gNextFreePaintStruct >= gEndOfPaintStructArray) {
+    // Money effects are painted with sprites, never while a tile is being recorded
+    if (_paintTileCacheRecording) {
+        paint_tile_cache_set_dynamic();
+        return;
+    }
+
+    if (!paint_reserve_entry()) {
         return;
     }
     paint_string_struct * ps = &gNextFreePaintStruct->string;
@@ -732,109 +1425,6 @@ void paint_generate_structs(rct_drawpixelinfo * dpi)
     }
 }
 
-static void paint_arrange_structs_helper(paint_struct * ps_next, uint16 ax, uint8 flag)
-{
-    paint_struct * ps;
-    paint_struct * ps_temp;
-    do {
-        ps = ps_next;
-        ps_next = ps_next->next_quadrant_ps;
-        if (ps_next == NULL) return;
-    } while (ax > ps_next->var_18);
-
-    ps_temp = ps;
-    do {
-        ps = ps->next_quadrant_ps;
-        if (ps == NULL) break;
-
-        if (ps->var_18 > ax + 1) {
-            ps->var_1B = 1 << 7;
-        }
-        else if (ps->var_18 == ax + 1) {
-            ps->var_1B = (1 << 1) | (1 << 0);
-        }
-        else if (ps->var_18 == ax) {
-            ps->var_1B = flag | (1 << 0);
-        }
-    } while (ps->var_18 <= ax + 1);
-    ps = ps_temp;
-
-    uint8 rotation = get_current_rotation();
-    while (true) {
-        while (true) {
-            ps_next = ps->next_quadrant_ps;
-            if (ps_next == NULL) return;
-            if (ps_next->var_1B & (1 << 7)) return;
-            if (ps_next->var_1B & (1 << 0)) break;
-            ps = ps_next;
-        }
-
-        ps_next->var_1B &= ~(1 << 0);
-        ps_temp = ps;
-
-        typedef struct bound_box {
-            uint16 x;
-            uint16 y;
-            uint16 z;
-            uint16 x_end;
-            uint16 y_end;
-            uint16 z_end;
-        } bound_box;
-
-        bound_box initialBBox = {
-            .x = ps_next->bound_box_x,
-            .y = ps_next->bound_box_y,
-            .z = ps_next->bound_box_z,
-            .x_end = ps_next->bound_box_x_end,
-            .y_end = ps_next->bound_box_y_end,
-            .z_end = ps_next->bound_box_z_end
-        };
-
-
-        while (true) {
-            ps = ps_next;
-            ps_next = ps_next->next_quadrant_ps;
-            if (ps_next == NULL) break;
-            if (ps_next->var_1B & (1 << 7)) break;
-            if (!(ps_next->var_1B & (1 << 1))) continue;
-
-            sint32 yes = 0;
-            switch (rotation) {
-            case 0:
-                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end >= ps_next->bound_box_y && initialBBox.x_end >= ps_next->bound_box_x
-                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y < ps_next->bound_box_y_end && initialBBox.x < ps_next->bound_box_x_end))
-                    yes = 1;
-                break;
-            case 1:
-                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end >= ps_next->bound_box_y && initialBBox.x_end < ps_next->bound_box_x
-                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y < ps_next->bound_box_y_end && initialBBox.x >= ps_next->bound_box_x_end))
-                    yes = 1;
-                break;
-            case 2:
-                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end < ps_next->bound_box_y && initialBBox.x_end < ps_next->bound_box_x
-                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y >= ps_next->bound_box_y_end && initialBBox.x >= ps_next->bound_box_x_end))
-                    yes = 1;
-                break;
-            case 3:
-                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end < ps_next->bound_box_y && initialBBox.x_end >= ps_next->bound_box_x
-                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y >= ps_next->bound_box_y_end && initialBBox.x < ps_next->bound_box_x_end))
-                    yes = 1;
-                break;
-            }
-
-            if (yes) {
-                ps->next_quadrant_ps = ps_next->next_quadrant_ps;
-                paint_struct *ps_temp2 = ps_temp->next_quadrant_ps;
-                ps_temp->next_quadrant_ps = ps_next;
-                ps_next->next_quadrant_ps = ps_temp2;
-                ps_next = ps;
-            }
-        }
-
-        ps = ps_temp;
-    }
-}
-
 /**
  *
  *  rct2: 0x00688217
@@ -842,26 +1432,12 @@ static void paint_arrange_structs_helper(paint_struct * ps_next, uint16 ax, uint
 paint_struct paint_arrange_structs()
 {
     paint_struct psHead = { 0 };
-    paint_struct * ps = &psHead;
-    ps->next_quadrant_ps = NULL;
-    uint32 quadrantIndex = _paintQuadrantBackIndex;
-    if (quadrantIndex != UINT32_MAX) {
-        do {
-            paint_struct * ps_next = _paintQuadrants[quadrantIndex];
-            if (ps_next != NULL) {
-                ps->next_quadrant_ps = ps_next;
-                do {
-                    ps = ps_next;
-                    ps_next = ps_next->next_quadrant_ps;
-                } while (ps_next != NULL);
-            }
-        } while (++quadrantIndex <= _paintQuadrantFrontIndex);
-
-        paint_arrange_structs_helper(&psHead, _paintQuadrantBackIndex & 0xFFFF, 1 << 1);
-
-        quadrantIndex = _paintQuadrantBackIndex;
-        while (++quadrantIndex < _paintQuadrantFrontIndex) {
-            paint_arrange_structs_helper(&psHead, quadrantIndex & 0xFFFF, 0);
+    psHead.next_quadrant_ps = NULL;
+    if (_paintQuadrantBackIndex != UINT32_MAX) {
+        uint8 rotation = get_current_rotation();
+        if (!paint_sort_quadrants(&psHead, _paintQuadrants, _paintQuadrantBackIndex, _paintQuadrantFrontIndex, rotation)) {
+            log_error("Unable to allocate the paint sort array, falling back to sorting the paint struct list.");
+            paint_sort_quadrants_list(&psHead, _paintQuadrants, _paintQuadrantBackIndex, _paintQuadrantFrontIndex, rotation);
         }
     }
     return psHead;
@@ -31,7 +31,11 @@ typedef struct attached_paint_struct attached_paint_struct;
 typedef struct paint_struct paint_struct;
 typedef union paint_entry paint_entry;
 
+// The RCT2 layout is only required when sharing these structs with the original game code,
+// otherwise leave them naturally aligned which is kinder to the arrange and draw passes.
+#ifndef NO_RCT2
 #pragma pack(push, 1)
+#endif
 /* size 0x12 */
 struct attached_paint_struct {
     uint32 image_id;        // 0x00
@@ -46,8 +50,7 @@ struct attached_paint_struct {
     uint8 pad_0D;
     attached_paint_struct* next;    //0x0E
 };
-#ifdef PLATFORM_32BIT
-// TODO: drop packing from this when all rendering is done.
+#if defined(PLATFORM_32BIT) && !defined(NO_RCT2)
 assert_struct_size(attached_paint_struct, 0x12);
 #endif
 
@@ -80,8 +83,7 @@ struct paint_struct {
     uint16 map_y;           // 0x2E
     rct_map_element *mapElement; // 0x30 (or sprite pointer)
 };
-#ifdef PLATFORM_32BIT
-// TODO: drop packing from this when all rendering is done.
+#if defined(PLATFORM_32BIT) && !defined(NO_RCT2)
 assert_struct_size(paint_struct, 0x34);
 #endif
 
@@ -99,10 +101,12 @@ struct paint_string_struct {
     uint32 args[4];                 // 0x0A
     uint8 *y_offsets;               // 0x1A
 };
-#ifdef PLATFORM_32BIT
+#if defined(PLATFORM_32BIT) && !defined(NO_RCT2)
 assert_struct_size(paint_string_struct, 0x1e);
 #endif
+#ifndef NO_RCT2
 #pragma pack(pop)
+#endif
 
 union paint_entry{
     paint_struct basic;
@@ -156,6 +160,7 @@ extern paint_string_struct * gPaintPSStringHead;
 /** rct2: 0x00993CC4 */
 extern const uint32 construction_markers[];
 extern bool gPaintBoundingBoxes;
+extern bool gPaintTileCacheEnabled;
 
 paint_struct * sub_98196C(uint32 image_id, sint8 x_offset, sint8 y_offset, sint16 bound_box_length_x, sint16 bound_box_length_y, sint8 bound_box_length_z, sint16 z_offset, uint32 rotation);
 paint_struct * sub_98197C(uint32 image_id, sint8 x_offset, sint8 y_offset, sint16 bound_box_length_x, sint16 bound_box_length_y, sint8 bound_box_length_z, sint16 z_offset, sint16 bound_box_offset_x, sint16 bound_box_offset_y, sint16 bound_box_offset_z, uint32 rotation);
@@ -172,6 +177,12 @@ bool paint_attach_to_previous_attach(uint32 image_id, uint16 x, uint16 y);
 bool paint_attach_to_previous_ps(uint32 image_id, uint16 x, uint16 y);
 void paint_floating_money_effect(money32 amount, rct_string_id string_id, sint16 y, sint16 z, sint8 y_offsets[], sint16 offset_x, uint32 rotation);
 
+bool paint_tile_cache_begin(sint32 tileX, sint32 tileY, rct_map_element * firstElement);
+void paint_tile_cache_end();
+void paint_tile_cache_set_dynamic();
+void paint_tile_cache_invalidate_tile(sint32 tileX, sint32 tileY);
+void paint_tile_cache_invalidate_all();
+
 void paint_init(rct_drawpixelinfo * dpi);
 void paint_generate_structs(rct_drawpixelinfo * dpi);
 paint_struct paint_arrange_structs();
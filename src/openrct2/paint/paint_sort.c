@@ -0,0 +1,300 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include "paint_sort.h"
+
+typedef struct paint_sort_entry {
+    sint32 x, y, z;
+    sint32 x_end, y_end, z_end;
+    uint16 quadrant;
+    uint8 flags;
+} paint_sort_entry;
+
+// The paint struct of each entry is kept at the same index in a separate array, keeping the entries scanned by the
+// sort small
+static paint_sort_entry * _paintSortEntries = NULL;
+static paint_struct * * _paintSortStructs = NULL;
+static size_t _paintSortEntriesCapacity = 0;
+
+/**
+ * Fills in the bounding box of a sort entry so that the overlap test is the same for every
+ * rotation. An axis that is mirrored by the rotation is negated, with the end offset by one so
+ * that the test below matches the strict / non-strict comparisons of the unrotated case.
+ */
+static void paint_sort_entry_set_bound_box(paint_sort_entry * entry, const paint_struct * ps, bool flipX, bool flipY)
+{
+    entry->x = flipX ? -ps->bound_box_x : ps->bound_box_x;
+    entry->x_end = flipX ? -ps->bound_box_x_end + 1 : ps->bound_box_x_end;
+    entry->y = flipY ? -ps->bound_box_y : ps->bound_box_y;
+    entry->y_end = flipY ? -ps->bound_box_y_end + 1 : ps->bound_box_y_end;
+    entry->z = ps->bound_box_z;
+    entry->z_end = ps->bound_box_z_end;
+}
+
+/**
+ * Sorts the entries of quadrant ax and ax + 1 in the same way as paint_sort_list_helper, moving any entry that should be drawn behind an entry in front of it.
+ * @param start the index to search for the first entry of quadrant ax from.
+ * @returns the index of the first entry of quadrant ax.
+ */
+static size_t paint_sort_helper(paint_sort_entry * entries, size_t count, size_t start, uint16 ax, uint8 flag, sint32 adjustX, sint32 adjustY)
+{
+    while (start < count && ax > entries[start].quadrant) {
+        start++;
+    }
+    if (start >= count) {
+        return start;
+    }
+
+    // Flag the entries in the quadrant and the one after
+    size_t end = start;
+    for (; end < count; end++) {
+        paint_sort_entry * entry = &entries[end];
+        if (entry->quadrant > ax + 1) {
+            break;
+        }
+        else if (entry->quadrant == ax + 1) {
+            entry->flags = (1 << 1) | (1 << 0);
+        }
+        else if (entry->quadrant == ax) {
+            entry->flags = flag | (1 << 0);
+        }
+    }
+
+    size_t index = start;
+    while (true) {
+        while (index < end && !(entries[index].flags & (1 << 0))) {
+            index++;
+        }
+        if (index >= end) {
+            break;
+        }
+
+        entries[index].flags &= ~(1 << 0);
+        const paint_sort_entry initialBBox = entries[index];
+
+        for (size_t i = index + 1; i < end; i++) {
+            const paint_sort_entry * entry = &entries[i];
+            if (!(entry->flags & (1 << 1))) continue;
+
+            if (initialBBox.z_end >= entry->z && initialBBox.y_end + adjustY >= entry->y && initialBBox.x_end + adjustX >= entry->x
+                && !(initialBBox.z < entry->z_end && initialBBox.y < entry->y_end && initialBBox.x < entry->x_end))
+            {
+                // Move the entry in front of the one being sorted
+                paint_sort_entry movedEntry = *entry;
+                memmove(&entries[index + 1], &entries[index], (i - index) * sizeof(paint_sort_entry));
+                entries[index] = movedEntry;
+                paint_struct * movedPs = _paintSortStructs[i];
+                memmove(&_paintSortStructs[index + 1], &_paintSortStructs[index], (i - index) * sizeof(paint_struct *));
+                _paintSortStructs[index] = movedPs;
+            }
+        }
+    }
+    return start;
+}
+
+/**
+ * Sorts the quadrants in a flat array of sort entries, which is reused between frames.
+ * @returns false, leaving the quadrants untouched, if the array could not be grown to hold every paint struct.
+ */
+bool paint_sort_quadrants(paint_struct * head, paint_struct * * quadrants, uint32 backIndex, uint32 frontIndex, uint8 rotation)
+{
+    head->next_quadrant_ps = NULL;
+
+    size_t count = 0;
+    for (uint32 quadrantIndex = backIndex; quadrantIndex <= frontIndex; quadrantIndex++) {
+        for (paint_struct * ps = quadrants[quadrantIndex]; ps != NULL; ps = ps->next_quadrant_ps) {
+            count++;
+        }
+    }
+    if (count > _paintSortEntriesCapacity) {
+        size_t newCapacity = max(1024, _paintSortEntriesCapacity * 2);
+        newCapacity = max(newCapacity, count);
+        paint_sort_entry * newEntries = realloc(_paintSortEntries, newCapacity * sizeof(paint_sort_entry));
+        if (newEntries == NULL) {
+            return false;
+        }
+        _paintSortEntries = newEntries;
+        paint_struct * * newStructs = realloc(_paintSortStructs, newCapacity * sizeof(paint_struct *));
+        if (newStructs == NULL) {
+            return false;
+        }
+        _paintSortStructs = newStructs;
+        _paintSortEntriesCapacity = newCapacity;
+    }
+
+    bool flipX = rotation == 1 || rotation == 2;
+    bool flipY = rotation == 2 || rotation == 3;
+
+    // Flatten the quadrants, back to front, into the array
+    paint_sort_entry * entry = _paintSortEntries;
+    for (uint32 quadrantIndex = backIndex; quadrantIndex <= frontIndex; quadrantIndex++) {
+        for (paint_struct * ps = quadrants[quadrantIndex]; ps != NULL; ps = ps->next_quadrant_ps) {
+            paint_sort_entry_set_bound_box(entry, ps, flipX, flipY);
+            _paintSortStructs[entry - _paintSortEntries] = ps;
+            entry->quadrant = ps->var_18;
+            entry->flags = 0;
+            entry++;
+        }
+    }
+
+    sint32 adjustX = flipX ? -2 : 0;
+    sint32 adjustY = flipY ? -2 : 0;
+    size_t start = paint_sort_helper(_paintSortEntries, count, 0, backIndex & 0xFFFF, 1 << 1, adjustX, adjustY);
+    for (uint32 quadrantIndex = backIndex + 1; quadrantIndex < frontIndex; quadrantIndex++) {
+        start = paint_sort_helper(_paintSortEntries, count, start, quadrantIndex & 0xFFFF, 0, adjustX, adjustY);
+    }
+
+    // Link the paint structs back up in their sorted order
+    paint_struct * ps = head;
+    for (size_t i = 0; i < count; i++) {
+        ps->next_quadrant_ps = _paintSortStructs[i];
+        ps = ps->next_quadrant_ps;
+    }
+    ps->next_quadrant_ps = NULL;
+    return true;
+}
+
+static void paint_sort_list_helper(paint_struct * ps_next, uint16 ax, uint8 flag, uint8 rotation)
+{
+    paint_struct * ps;
+    paint_struct * ps_temp;
+    do {
+        ps = ps_next;
+        ps_next = ps_next->next_quadrant_ps;
+        if (ps_next == NULL) return;
+    } while (ax > ps_next->var_18);
+
+    ps_temp = ps;
+    do {
+        ps = ps->next_quadrant_ps;
+        if (ps == NULL) break;
+
+        if (ps->var_18 > ax + 1) {
+            ps->var_1B = 1 << 7;
+        }
+        else if (ps->var_18 == ax + 1) {
+            ps->var_1B = (1 << 1) | (1 << 0);
+        }
+        else if (ps->var_18 == ax) {
+            ps->var_1B = flag | (1 << 0);
+        }
+    } while (ps->var_18 <= ax + 1);
+    ps = ps_temp;
+
+    while (true) {
+        while (true) {
+            ps_next = ps->next_quadrant_ps;
+            if (ps_next == NULL) return;
+            if (ps_next->var_1B & (1 << 7)) return;
+            if (ps_next->var_1B & (1 << 0)) break;
+            ps = ps_next;
+        }
+
+        ps_next->var_1B &= ~(1 << 0);
+        ps_temp = ps;
+
+        typedef struct bound_box {
+            uint16 x;
+            uint16 y;
+            uint16 z;
+            uint16 x_end;
+            uint16 y_end;
+            uint16 z_end;
+        } bound_box;
+
+        bound_box initialBBox = {
+            .x = ps_next->bound_box_x,
+            .y = ps_next->bound_box_y,
+            .z = ps_next->bound_box_z,
+            .x_end = ps_next->bound_box_x_end,
+            .y_end = ps_next->bound_box_y_end,
+            .z_end = ps_next->bound_box_z_end
+        };
+
+
+        while (true) {
+            ps = ps_next;
+            ps_next = ps_next->next_quadrant_ps;
+            if (ps_next == NULL) break;
+            if (ps_next->var_1B & (1 << 7)) break;
+            if (!(ps_next->var_1B & (1 << 1))) continue;
+
+            sint32 yes = 0;
+            switch (rotation) {
+            case 0:
+                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end >= ps_next->bound_box_y && initialBBox.x_end >= ps_next->bound_box_x
+                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y < ps_next->bound_box_y_end && initialBBox.x < ps_next->bound_box_x_end))
+                    yes = 1;
+                break;
+            case 1:
+                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end >= ps_next->bound_box_y && initialBBox.x_end < ps_next->bound_box_x
+                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y < ps_next->bound_box_y_end && initialBBox.x >= ps_next->bound_box_x_end))
+                    yes = 1;
+                break;
+            case 2:
+                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end < ps_next->bound_box_y && initialBBox.x_end < ps_next->bound_box_x
+                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y >= ps_next->bound_box_y_end && initialBBox.x >= ps_next->bound_box_x_end))
+                    yes = 1;
+                break;
+            case 3:
+                if (initialBBox.z_end >= ps_next->bound_box_z && initialBBox.y_end < ps_next->bound_box_y && initialBBox.x_end >= ps_next->bound_box_x
+                    && !(initialBBox.z < ps_next->bound_box_z_end && initialBBox.y >= ps_next->bound_box_y_end && initialBBox.x < ps_next->bound_box_x_end))
+                    yes = 1;
+                break;
+            }
+
+            if (yes) {
+                ps->next_quadrant_ps = ps_next->next_quadrant_ps;
+                paint_struct *ps_temp2 = ps_temp->next_quadrant_ps;
+                ps_temp->next_quadrant_ps = ps_next;
+                ps_next->next_quadrant_ps = ps_temp2;
+                ps_next = ps;
+            }
+        }
+
+        ps = ps_temp;
+    }
+}
+
+/**
+ * Sorts the quadrants by moving the paint structs around in their linked list. This is the original
+ * implementation, used when there is not enough memory for the sort array.
+ *  rct2: 0x00688217
+ */
+void paint_sort_quadrants_list(paint_struct * head, paint_struct * * quadrants, uint32 backIndex, uint32 frontIndex, uint8 rotation)
+{
+    paint_struct * ps = head;
+    ps->next_quadrant_ps = NULL;
+
+    uint32 quadrantIndex = backIndex;
+    do {
+        paint_struct * ps_next = quadrants[quadrantIndex];
+        if (ps_next != NULL) {
+            ps->next_quadrant_ps = ps_next;
+            do {
+                ps = ps_next;
+                ps_next = ps_next->next_quadrant_ps;
+            } while (ps_next != NULL);
+        }
+    } while (++quadrantIndex <= frontIndex);
+
+    paint_sort_list_helper(head, backIndex & 0xFFFF, 1 << 1, rotation);
+
+    quadrantIndex = backIndex;
+    while (++quadrantIndex < frontIndex) {
+        paint_sort_list_helper(head, quadrantIndex & 0xFFFF, 0, rotation);
+    }
+}
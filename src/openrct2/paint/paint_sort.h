@@ -0,0 +1,29 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#ifndef _PAINT_SORT_H
+#define _PAINT_SORT_H
+
+#include "paint.h"
+
+/**
+ * Links the paint structs of quadrants backIndex to frontIndex into a single list after head, in the order they
+ * are to be drawn for the given rotation.
+ */
+bool paint_sort_quadrants(paint_struct * head, paint_struct * * quadrants, uint32 backIndex, uint32 frontIndex, uint8 rotation);
+void paint_sort_quadrants_list(paint_struct * head, paint_struct * * quadrants, uint32 backIndex, uint32 frontIndex, uint8 rotation);
+
+#endif
@@ -31,10 +31,12 @@
 #include "../rct2.h"
 #include "../ride/ride.h"
 #include "../ride/ride_data.h"
+#include "../ride/RideIndex.h"
 #include "../ride/track.h"
 #include "../scenario/scenario.h"
 #include "../sprites.h"
 #include "../util/util.h"
+#include "../world/AmenityField.h"
 #include "../world/Climate.h"
 #include "../world/entrance.h"
 #include "../world/footpath.h"
@@ -535,6 +537,9 @@ void peep_update_all()
     if (gScreenFlags & (SCREEN_FLAGS_SCENARIO_EDITOR | SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER))
         return;
 
+    // Peeps are updated one by one in list order. A guest's decisions draw from scenario_rand as they are made
+    // and act on what earlier guests in the list did this tick: queue lengths, ride and shop takings, litter
+    // and the number of guests in the park. Deciding for several guests at once would change the outcome.
     spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP];
     i = 0;
     while (spriteIndex != SPRITE_INDEX_NULL) {
@@ -554,6 +559,38 @@ void peep_update_all()
     }
 }
 
+/**
+ * Gets the music guests can hear from open rides with track on the tiles in the given range: 1 for merry-go-rounds
+ * and organ music, 2 for dodgems.
+ */
+static uint16 peep_get_nearby_music(sint32 left, sint32 top, sint32 right, sint32 bottom)
+{
+    uint16 nearby_music = 0;
+    for (sint32 i = 0; i < MAX_RIDES; i++) {
+        rct_ride *ride = get_ride(i);
+        if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC) ||
+            ride->status == RIDE_STATUS_CLOSED ||
+            (ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))) {
+            continue;
+        }
+
+        uint16 music;
+        if (ride->type == RIDE_TYPE_MERRY_GO_ROUND || ride->music == MUSIC_STYLE_ORGAN) {
+            music = 1;
+        } else if (ride->type == RIDE_TYPE_DODGEMS) {
+            // Dodgems drown out music?
+            music = 2;
+        } else {
+            continue;
+        }
+
+        if (!(nearby_music & music) && ride_index_ride_has_track_in_range(i, left, top, right, bottom)) {
+            nearby_music |= music;
+        }
+    }
+    return nearby_music;
+}
+
 /**
  *
  *  rct2: 0x0069BC9A
@@ -562,87 +599,19 @@ static uint8 peep_assess_surroundings(sint16 center_x, sint16 center_y, sint16 c
     if ((map_element_height(center_x, center_y) & 0xFFFF) > center_z)
         return PEEP_THOUGHT_TYPE_NONE;
 
-    uint16 num_scenery = 0;
-    uint16 num_fountains = 0;
-    uint16 nearby_music = 0;
-    uint16 num_rubbish = 0;
+    const amenity_counts *counts = amenity_field_get(center_x, center_y);
+    if (counts->invalid_path_items != 0)
+        return PEEP_THOUGHT_TYPE_NONE;
+
+    uint16 num_scenery = counts->scenery;
+    uint16 num_fountains = counts->fountains;
+    uint16 num_rubbish = counts->broken_path_items + counts->litter;
 
     sint16 initial_x = max(center_x - 160, 0);
     sint16 initial_y = max(center_y - 160, 0);
     sint16 final_x = min(center_x + 160, 8192);
     sint16 final_y = min(center_y + 160, 8192);
-
-    for (sint16 x = initial_x; x < final_x; x += 32){
-        for (sint16 y = initial_y; y < final_y; y += 32){
-            rct_map_element* mapElement = map_get_first_element_at(x / 32, y / 32);
-
-            do{
-                rct_ride* ride;
-                rct_scenery_entry* scenery;
-
-                switch (map_element_get_type(mapElement)){
-                case MAP_ELEMENT_TYPE_PATH:
-                    if (!footpath_element_has_path_scenery(mapElement))
-                        break;
-
-                    scenery = get_footpath_item_entry(footpath_element_get_path_scenery_index(mapElement));
-                    if (scenery == NULL) {
-                        return PEEP_THOUGHT_TYPE_NONE;
-                    }
-                    if (footpath_element_path_scenery_is_ghost(mapElement))
-                        break;
-
-                    if (scenery->path_bit.flags &
-                        (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER |
-                        PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW)){
-                        num_fountains++;
-                        break;
-                    }
-                    if (mapElement->flags & MAP_ELEMENT_FLAG_BROKEN){
-                        num_rubbish++;
-                    }
-                    break;
-                case MAP_ELEMENT_TYPE_SCENERY_MULTIPLE:
-                case MAP_ELEMENT_TYPE_SCENERY:
-                    num_scenery++;
-                    break;
-                case MAP_ELEMENT_TYPE_TRACK:
-                    ride = get_ride(mapElement->properties.track.ride_index);
-                    if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC &&
-                        ride->status != RIDE_STATUS_CLOSED &&
-                        !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))){
-
-                        if (ride->type == RIDE_TYPE_MERRY_GO_ROUND){
-                            nearby_music |= 1;
-                            break;
-                        }
-
-                        if (ride->music == MUSIC_STYLE_ORGAN){
-                            nearby_music |= 1;
-                            break;
-                        }
-
-                        if (ride->type == RIDE_TYPE_DODGEMS){
-                            // Dodgems drown out music?
-                            nearby_music |= 2;
-                        }
-                    }
-                    break;
-                }
-            } while (!map_element_is_last_for_tile(mapElement++));
-        }
-    }
-
-    rct_litter* litter;
-    for (uint16 sprite_idx = gSpriteListHead[SPRITE_LIST_LITTER]; sprite_idx != SPRITE_INDEX_NULL; sprite_idx = litter->next) {
-        litter = &(get_sprite(sprite_idx)->litter);
-
-        sint16 dist_x = abs(litter->x - center_x);
-        sint16 dist_y = abs(litter->y - center_y);
-        if (max(dist_x, dist_y) <= 160) {
-            num_rubbish++;
-        }
-    }
+    uint16 nearby_music = peep_get_nearby_music(initial_x / 32, initial_y / 32, (final_x - 1) / 32, (final_y - 1) / 32);
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PEEP_THOUGHT_TYPE_FOUNTAINS;
@@ -5558,7 +5527,9 @@ static void peep_update_walking_break_scenery(rct_peep* peep){
         if (max(x_diff, y_diff) < 224)return;
     }
 
+    amenity_field_remove_element(peep->next_x / 32, peep->next_y / 32, map_element);
     map_element->flags |= MAP_ELEMENT_FLAG_BROKEN;
+    amenity_field_add_element(peep->next_x / 32, peep->next_y / 32, map_element);
 
     map_invalidate_tile_zoom1(
         peep->next_x,
@@ -12019,6 +11990,16 @@ static bool peep_should_go_to_shop(rct_peep *peep, sint32 rideIndex, bool peepAt
     return true;
 }
 
+/**
+ * Adds the rides with track within 10 tiles of the peep to _peepRideConsideration.
+ */
+static void peep_consider_nearby_rides(rct_peep *peep, sint32 rideType, uint32 rideTypeFlags)
+{
+    sint32 tileX = peep->x >> 5;
+    sint32 tileY = peep->y >> 5;
+    ride_index_find_rides_in_range(_peepRideConsideration, rideType, rideTypeFlags, tileX - 10, tileY - 10, tileX + 10, tileY + 10);
+}
+
 /**
  *
  *  rct2: 0x00695DD2
@@ -12050,21 +12031,7 @@ static void peep_pick_ride_to_go_on(rct_peep *peep)
         }
     } else {
         // Take nearby rides into consideration
-        sint32 cx = floor2(peep->x, 32);
-        sint32 cy = floor2(peep->y, 32);
-        for (sint32 x = cx - 320; x <= cx + 320; x += 32) {
-            for (sint32 y = cy - 320; y <= cy + 320; y += 32) {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32)) {
-                    rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do {
-                        if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
-
-                        sint32 rideIndex = mapElement->properties.track.ride_index;
-                        _peepRideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                    } while (!map_element_is_last_for_tile(mapElement++));
-                }
-            }
-        }
+        peep_consider_nearby_rides(peep, RIDE_INDEX_ANY_TYPE, 0);
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         sint32 i;
@@ -12153,32 +12120,10 @@ static void peep_head_for_nearest_ride_type(rct_peep *peep, sint32 rideType)
     // FIX Originally checked for a toy,.likely a mistake and should be a map
     if ((peep->item_standard_flags & PEEP_ITEM_MAP) && rideType != RIDE_TYPE_FIRST_AID) {
         // Consider all rides in the park
-        sint32 i;
-        FOR_ALL_RIDES(i, ride) {
-            if (ride->type == rideType) {
-                _peepRideConsideration[i >> 5] |= (1u << (i & 0x1F));
-            }
-        }
+        ride_index_find_rides(_peepRideConsideration, rideType, 0);
     } else {
         // Take nearby rides into consideration
-        sint32 cx = floor2(peep->x, 32);
-        sint32 cy = floor2(peep->y, 32);
-        for (sint32 x = cx - 320; x <= cx + 320; x += 32) {
-            for (sint32 y = cy - 320; y <= cy + 320; y += 32) {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32)) {
-                    rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do {
-                        if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
-
-                        sint32 rideIndex = mapElement->properties.track.ride_index;
-                        ride = get_ride(rideIndex);
-                        if (ride->type == rideType) {
-                            _peepRideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                        }
-                    } while (!map_element_is_last_for_tile(mapElement++));
-                }
-            }
-        }
+        peep_consider_nearby_rides(peep, rideType, 0);
     }
 
     // Filter the considered rides
@@ -12260,32 +12205,10 @@ static void peep_head_for_nearest_ride_with_flags(rct_peep *peep, sint32 rideTyp
     // FIX Originally checked for a toy,.likely a mistake and should be a map
     if (peep->item_standard_flags & PEEP_ITEM_MAP) {
         // Consider all rides in the park
-        sint32 i;
-        FOR_ALL_RIDES(i, ride) {
-            if (ride_type_has_flag(ride->type, rideTypeFlags)) {
-                _peepRideConsideration[i >> 5] |= (1u << (i & 0x1F));
-            }
-        }
+        ride_index_find_rides(_peepRideConsideration, RIDE_INDEX_ANY_TYPE, rideTypeFlags);
     } else {
         // Take nearby rides into consideration
-        sint32 cx = floor2(peep->x, 32);
-        sint32 cy = floor2(peep->y, 32);
-        for (sint32 x = cx - 320; x <= cx + 320; x += 32) {
-            for (sint32 y = cy - 320; y <= cy + 320; y += 32) {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32)) {
-                    rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do {
-                        if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
-
-                        sint32 rideIndex = mapElement->properties.track.ride_index;
-                        ride = get_ride(rideIndex);
-                        if (ride_type_has_flag(ride->type, rideTypeFlags)) {
-                            _peepRideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                        }
-                    } while (!map_element_is_last_for_tile(mapElement++));
-                }
-            }
-        }
+        peep_consider_nearby_rides(peep, RIDE_INDEX_ANY_TYPE, rideTypeFlags);
     }
 
     // Filter the considered rides
@@ -12371,6 +12294,57 @@ static void peep_give_real_name(rct_peep *peep)
     peep->name_string_idx = dx;
 }
 
+typedef struct peep_sort_name {
+    rct_string_id name_string_idx;
+    uint32 id;
+    utf8 *name;
+} peep_sort_name;
+
+// The names of peeps as formatted when they were last compared, by sprite index
+static peep_sort_name _peepSortNames[MAX_SPRITES];
+static sint32 _peepSortNamesLanguage = -1;
+
+static void peep_sort_name_clear(uint16 spriteIndex)
+{
+    SafeFree(_peepSortNames[spriteIndex].name);
+}
+
+/**
+ * Clears the formatted names kept for sorting, for when the names of all peeps may have changed such as after
+ * loading a park.
+ */
+void peep_sort_names_invalidate()
+{
+    for (uint16 i = 0; i < MAX_SPRITES; i++) {
+        peep_sort_name_clear(i);
+    }
+}
+
+/**
+ * Gets the name of the peep as shown in game. It is only formatted again once the name or the language has
+ * changed.
+ */
+static const utf8 *peep_get_sort_name(rct_peep const *peep)
+{
+    if (_peepSortNamesLanguage != gCurrentLanguage) {
+        peep_sort_names_invalidate();
+        _peepSortNamesLanguage = gCurrentLanguage;
+    }
+
+    peep_sort_name *entry = &_peepSortNames[peep->sprite_index];
+    if (entry->name == NULL || entry->name_string_idx != peep->name_string_idx || entry->id != peep->id) {
+        utf8 name[256];
+        uint32 peepIndex = peep->id;
+        format_string(name, 256, peep->name_string_idx, &peepIndex);
+
+        SafeFree(entry->name);
+        entry->name = _strdup(name);
+        entry->name_string_idx = peep->name_string_idx;
+        entry->id = peep->id;
+    }
+    return entry->name;
+}
+
 static sint32 peep_compare(const void *sprite_index_a, const void *sprite_index_b)
 {
     rct_peep const *peep_a = GET_PEEP(*(uint16*)sprite_index_a);
@@ -12411,13 +12385,7 @@ static sint32 peep_compare(const void *sprite_index_a, const void *sprite_index_
 
     // At least one of them has a custom name assigned
     // Compare their names as strings
-    utf8 name_a[256];
-    utf8 name_b[256];
-    uint32 peepIndex = peep_a->id;
-    format_string(name_a, 256, peep_a->name_string_idx, &peepIndex);
-    peepIndex = peep_b->id;
-    format_string(name_b, 256, peep_b->name_string_idx, &peepIndex);
-    return strlogicalcmp(name_a, name_b);
+    return strlogicalcmp(peep_get_sort_name(peep_a), peep_get_sort_name(peep_b));
 }
 
 /**
@@ -12426,6 +12394,9 @@ static sint32 peep_compare(const void *sprite_index_a, const void *sprite_index_
  */
 void peep_update_name_sort(rct_peep *peep)
 {
+    // A renamed peep can be given back the user string it had before, so its name is always formatted again
+    peep_sort_name_clear(peep->sprite_index);
+
     // Remove peep from sprite list
     uint16 nextSpriteIndex = peep->next;
     uint16 prevSpriteIndex = peep->previous;
@@ -12460,7 +12431,7 @@ void peep_update_name_sort(rct_peep *peep)
             peep->next = gSpriteListHead[SPRITE_LIST_PEEP];
             gSpriteListHead[SPRITE_LIST_PEEP] = peep->sprite_index;
         }
-        goto finish_peep_sort;
+        return;
     }
 
     // Place peep at the end
@@ -12469,17 +12440,13 @@ void peep_update_name_sort(rct_peep *peep)
             otherPeep->next = peep->sprite_index;
             peep->previous = otherPeep->sprite_index;
             peep->next = SPRITE_INDEX_NULL;
-            goto finish_peep_sort;
+            return;
         }
     }
 
     gSpriteListHead[SPRITE_LIST_PEEP] = peep->sprite_index;
     peep->next = SPRITE_INDEX_NULL;
     peep->previous = SPRITE_INDEX_NULL;
-
-finish_peep_sort:
-    // This is required at the moment because this function reorders peeps in the sprite list
-    sprite_position_tween_reset();
 }
 
 void peep_sort()
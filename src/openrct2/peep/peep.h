@@ -758,6 +758,7 @@ void remove_peep_from_queue(rct_peep* peep);
 void peep_switch_to_special_sprite(rct_peep* peep, uint8 special_sprite_id);
 void peep_update_name_sort(rct_peep *peep);
 void peep_sort();
+void peep_sort_names_invalidate();
 void peep_update_names(bool realNames);
 
 money32 set_peep_name(sint32 flags, sint32 state, uint16 sprite_index, uint8* text_1, uint8* text_2, uint8* text_3);
@@ -46,6 +46,7 @@
 #include "ride/track.h"
 #include "ride/track_design.h"
 #include "ride/TrackDesignRepository.h"
+#include "ride/vehicle.h"
 #include "scenario/ScenarioRepository.h"
 #include "title/TitleScreen.h"
 #include "util/util.h"
@@ -164,12 +165,17 @@ bool rct2_init()
     }
     gfx_load_csg();
 
-    font_sprite_initialise_characters();
+    if (!gOpenRCT2NoGraphics) {
+        font_sprite_initialise_characters();
+    }
     if (!gOpenRCT2Headless) {
         // platform_init();
         audio_init_ride_sounds_and_info();
     }
     viewport_init_all();
+    if (!vehicle_move_info_init()) {
+        return false;
+    }
 
     game_init_all(150);
     if (!gOpenRCT2Headless)
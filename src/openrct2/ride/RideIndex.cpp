@@ -0,0 +1,231 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include <vector>
+#include "../core/Math.hpp"
+#include "RideIndex.h"
+
+extern "C"
+{
+    #include "../world/map.h"
+    #include "ride.h"
+}
+
+/**
+ * Guests deciding where to go query rides by type or by type flag, either across the park or within a few tiles
+ * of where they stand. Instead of scanning the map around every guest, the index keeps the tile bounds of each
+ * ride's track and the rides of each type. It is rebuilt on the next query after anything that can change the
+ * map or the rides, which is limited to game commands and loading a park. Ghost track, such as the piece
+ * previewed while building a ride, is left out so that ghost commands do not need to rebuild the index.
+ */
+struct RideTrackBounds
+{
+    bool  HasTrack;
+    uint8 Left;
+    uint8 Top;
+    uint8 Right;
+    uint8 Bottom;
+};
+
+// Track elements can refer to any of the 256 ride indices
+constexpr sint32 RIDE_INDEX_SIZE = 256;
+
+static bool _rideIndexValid = false;
+static RideTrackBounds _rideTrackBounds[RIDE_INDEX_SIZE];
+static std::vector<uint8> _ridesByType[RIDE_TYPE_COUNT];
+
+static void RideIndexBuild()
+{
+    for (auto &bounds : _rideTrackBounds)
+    {
+        bounds = { false, 255, 255, 0, 0 };
+    }
+    for (auto &rides : _ridesByType)
+    {
+        rides.clear();
+    }
+
+    for (sint32 y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (sint32 x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            rct_map_element * mapElement = map_get_first_element_at(x, y);
+            do
+            {
+                if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
+                if (mapElement->flags & MAP_ELEMENT_FLAG_GHOST) continue;
+
+                RideTrackBounds * bounds = &_rideTrackBounds[mapElement->properties.track.ride_index];
+                bounds->HasTrack = true;
+                bounds->Left = Math::Min(bounds->Left, (uint8)x);
+                bounds->Top = Math::Min(bounds->Top, (uint8)y);
+                bounds->Right = Math::Max(bounds->Right, (uint8)x);
+                bounds->Bottom = Math::Max(bounds->Bottom, (uint8)y);
+            }
+            while (!map_element_is_last_for_tile(mapElement++));
+        }
+    }
+
+    sint32 i;
+    rct_ride * ride;
+    FOR_ALL_RIDES(i, ride)
+    {
+        _ridesByType[ride->type].push_back((uint8)i);
+    }
+
+    _rideIndexValid = true;
+}
+
+static void RideIndexEnsureValid()
+{
+    if (!_rideIndexValid)
+    {
+        RideIndexBuild();
+    }
+}
+
+static void SetRideBit(uint32 * rideBits, sint32 rideIndex)
+{
+    rideBits[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
+}
+
+static bool RideHasTrackInRange(sint32 rideIndex, sint32 left, sint32 top, sint32 right, sint32 bottom)
+{
+    const RideTrackBounds * bounds = &_rideTrackBounds[rideIndex];
+    if (!bounds->HasTrack) return false;
+    if (bounds->Right < left || bounds->Left > right) return false;
+    if (bounds->Bottom < top || bounds->Top > bottom) return false;
+    if (bounds->Left >= left && bounds->Right <= right &&
+        bounds->Top >= top && bounds->Bottom <= bottom)
+    {
+        return true;
+    }
+
+    // The track only partly overlaps the range, check the tiles in common
+    sint32 x0 = Math::Max<sint32>(left, bounds->Left);
+    sint32 y0 = Math::Max<sint32>(top, bounds->Top);
+    sint32 x1 = Math::Min<sint32>(right, bounds->Right);
+    sint32 y1 = Math::Min<sint32>(bottom, bounds->Bottom);
+    for (sint32 y = y0; y <= y1; y++)
+    {
+        for (sint32 x = x0; x <= x1; x++)
+        {
+            rct_map_element * mapElement = map_get_first_element_at(x, y);
+            do
+            {
+                if (map_element_get_type(mapElement) == MAP_ELEMENT_TYPE_TRACK &&
+                    !(mapElement->flags & MAP_ELEMENT_FLAG_GHOST) &&
+                    mapElement->properties.track.ride_index == rideIndex)
+                {
+                    return true;
+                }
+            }
+            while (!map_element_is_last_for_tile(mapElement++));
+        }
+    }
+    return false;
+}
+
+template<typename TFunc>
+static void ForEachMatchingRide(sint32 rideType, uint32 rideTypeFlags, TFunc func)
+{
+    if (rideTypeFlags != 0)
+    {
+        for (sint32 type = 0; type < RIDE_TYPE_COUNT; type++)
+        {
+            if (ride_type_has_flag(type, rideTypeFlags))
+            {
+                for (uint8 rideIndex : _ridesByType[type])
+                {
+                    func(rideIndex);
+                }
+            }
+        }
+    }
+    else if (rideType != RIDE_INDEX_ANY_TYPE)
+    {
+        for (uint8 rideIndex : _ridesByType[rideType])
+        {
+            func(rideIndex);
+        }
+    }
+    else
+    {
+        for (const auto &rides : _ridesByType)
+        {
+            for (uint8 rideIndex : rides)
+            {
+                func(rideIndex);
+            }
+        }
+    }
+}
+
+extern "C"
+{
+    void ride_index_invalidate()
+    {
+        _rideIndexValid = false;
+    }
+
+    void ride_index_find_rides(uint32 * rideBits, sint32 rideType, uint32 rideTypeFlags)
+    {
+        RideIndexEnsureValid();
+        ForEachMatchingRide(rideType, rideTypeFlags, [rideBits](sint32 rideIndex) -> void
+        {
+            SetRideBit(rideBits, rideIndex);
+        });
+    }
+
+    void ride_index_find_rides_in_range(uint32 * rideBits, sint32 rideType, uint32 rideTypeFlags, sint32 left, sint32 top, sint32 right, sint32 bottom)
+    {
+        RideIndexEnsureValid();
+
+        left = Math::Max(left, 0);
+        top = Math::Max(top, 0);
+        right = Math::Min(right, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        bottom = Math::Min(bottom, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        if (left > right || top > bottom) return;
+
+        if (rideType == RIDE_INDEX_ANY_TYPE && rideTypeFlags == 0)
+        {
+            // Any track counts, including track left behind by a ride that no longer exists
+            for (sint32 rideIndex = 0; rideIndex < RIDE_INDEX_SIZE; rideIndex++)
+            {
+                if (RideHasTrackInRange(rideIndex, left, top, right, bottom))
+                {
+                    SetRideBit(rideBits, rideIndex);
+                }
+            }
+        }
+        else
+        {
+            ForEachMatchingRide(rideType, rideTypeFlags, [=](sint32 rideIndex) -> void
+            {
+                if (RideHasTrackInRange(rideIndex, left, top, right, bottom))
+                {
+                    SetRideBit(rideBits, rideIndex);
+                }
+            });
+        }
+    }
+
+    bool ride_index_ride_has_track_in_range(sint32 rideIndex, sint32 left, sint32 top, sint32 right, sint32 bottom)
+    {
+        RideIndexEnsureValid();
+        return RideHasTrackInRange(rideIndex, left, top, right, bottom);
+    }
+}
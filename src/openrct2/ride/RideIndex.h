@@ -0,0 +1,46 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#pragma once
+
+#include "../common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    // Matches rides of any type in the queries below
+    #define RIDE_INDEX_ANY_TYPE 255
+
+    void ride_index_invalidate();
+
+    /**
+     * Sets the bit of each ride of the given type, or of a type with any of the given flags, in rideBits
+     * (a MAX_RIDES bit set).
+     */
+    void ride_index_find_rides(uint32 * rideBits, sint32 rideType, uint32 rideTypeFlags);
+
+    /**
+     * As ride_index_find_rides but only for rides with a track element within the given tile range, inclusive.
+     * The result matches scanning every tile in the range for track elements that are not ghosts.
+     */
+    void ride_index_find_rides_in_range(uint32 * rideBits, sint32 rideType, uint32 rideTypeFlags, sint32 left, sint32 top, sint32 right, sint32 bottom);
+
+    /** Gets whether the ride has a non-ghost track element within the given tile range, inclusive. */
+    bool ride_index_ride_has_track_in_range(sint32 rideIndex, sint32 left, sint32 top, sint32 right, sint32 bottom);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,260 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include <vector>
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileStream.hpp"
+#include "../core/Memory.hpp"
+#include "TrackDesignPreviewCache.h"
+
+extern "C"
+{
+    #include "track_design.h"
+}
+
+#pragma pack(push, 1)
+struct TrackPreviewCacheHeader
+{
+    uint32  MagicNumber;
+    uint16  Version;
+};
+
+struct TrackPreviewCacheRecord
+{
+    uint64  FileHash;
+    uint32  Context;
+    money32 Cost;
+    uint8   Flags;
+    uint32  DataLength;
+};
+#pragma pack(pop)
+
+constexpr uint32 TRACK_PREVIEW_CACHE_MAGIC_NUMBER = 0x56455254;
+constexpr uint16 TRACK_PREVIEW_CACHE_VERSION = 1;
+// The cache is started over once it grows past this size
+constexpr uint64 TRACK_PREVIEW_CACHE_MAX_SIZE = 64 * 1024 * 1024;
+constexpr size_t TRACK_PREVIEW_PIXELS_SIZE = TRACK_PREVIEW_IMAGE_SIZE * 4;
+
+/**
+ * Previews are mostly transparent, so pixels are stored as runs of
+ * [uint16 zero count][uint16 literal count][literal bytes].
+ */
+static std::vector<uint8> EncodePixels(const uint8 * pixels)
+{
+    std::vector<uint8> result;
+    size_t i = 0;
+    while (i < TRACK_PREVIEW_PIXELS_SIZE)
+    {
+        size_t zeroes = 0;
+        while (i < TRACK_PREVIEW_PIXELS_SIZE && pixels[i] == 0 && zeroes < UINT16_MAX)
+        {
+            zeroes++;
+            i++;
+        }
+        size_t literalStart = i;
+        while (i < TRACK_PREVIEW_PIXELS_SIZE && pixels[i] != 0 && i - literalStart < UINT16_MAX)
+        {
+            i++;
+        }
+        uint16 zeroCount = (uint16)zeroes;
+        uint16 literalCount = (uint16)(i - literalStart);
+        result.insert(result.end(), (uint8 *)&zeroCount, (uint8 *)&zeroCount + sizeof(zeroCount));
+        result.insert(result.end(), (uint8 *)&literalCount, (uint8 *)&literalCount + sizeof(literalCount));
+        result.insert(result.end(), pixels + literalStart, pixels + i);
+    }
+    return result;
+}
+
+static bool DecodePixels(const std::vector<uint8> &data, uint8 * pixels)
+{
+    size_t src = 0;
+    size_t dst = 0;
+    while (src + 4 <= data.size())
+    {
+        uint16 zeroCount = *((uint16 *)&data[src]);
+        uint16 literalCount = *((uint16 *)&data[src + 2]);
+        src += 4;
+        if (dst + zeroCount + literalCount > TRACK_PREVIEW_PIXELS_SIZE || src + literalCount > data.size())
+        {
+            return false;
+        }
+        Memory::Set(pixels + dst, 0, zeroCount);
+        dst += zeroCount;
+        Memory::Copy(pixels + dst, &data[src], literalCount);
+        dst += literalCount;
+        src += literalCount;
+    }
+    return dst == TRACK_PREVIEW_PIXELS_SIZE;
+}
+
+TrackDesignPreviewCache::TrackDesignPreviewCache(const std::string &path)
+    : _path(path)
+{
+}
+
+bool TrackDesignPreviewCache::Get(const std::string &trackPath, uint32 context, uint8 * pixels, money32 * cost, uint8 * flags, uint64 * fileHash)
+{
+    Load();
+
+    bool result = false;
+    *fileHash = 0;
+    try
+    {
+        *fileHash = GetFileHash(trackPath);
+        auto it = _offsets.find(GetKey(*fileHash, context));
+        if (it != _offsets.end())
+        {
+            auto fs = FileStream(_path, FILE_MODE_OPEN);
+            fs.SetPosition(it->second);
+            auto record = fs.ReadValue<TrackPreviewCacheRecord>();
+            if (record.FileHash == *fileHash && record.Context == context)
+            {
+                std::vector<uint8> data(record.DataLength);
+                fs.Read(data.data(), data.size());
+                if (DecodePixels(data, pixels))
+                {
+                    *cost = record.Cost;
+                    *flags = record.Flags;
+                    result = true;
+                }
+            }
+        }
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to read track design preview cache.");
+    }
+    return result;
+}
+
+void TrackDesignPreviewCache::Set(uint64 fileHash, uint32 context, const uint8 * pixels, money32 cost, uint8 flags)
+{
+    if (fileHash == 0)
+    {
+        return;
+    }
+
+    Load();
+
+    try
+    {
+        TrackPreviewCacheRecord record;
+        record.FileHash = fileHash;
+        record.Context = context;
+        record.Cost = cost;
+        record.Flags = flags;
+        std::vector<uint8> data = EncodePixels(pixels);
+        record.DataLength = (uint32)data.size();
+
+        if (!File::Exists(_path) || _length + sizeof(record) + data.size() > TRACK_PREVIEW_CACHE_MAX_SIZE)
+        {
+            Reset();
+        }
+
+        auto fs = FileStream(_path, FILE_MODE_UPDATE);
+        fs.Seek(0, STREAM_SEEK_END);
+        uint64 offset = fs.GetPosition();
+        fs.WriteValue(record);
+        fs.Write(data.data(), data.size());
+        _offsets[GetKey(record.FileHash, context)] = offset;
+        _length = fs.GetLength();
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to write track design preview cache.");
+    }
+}
+
+void TrackDesignPreviewCache::Load()
+{
+    if (_loaded)
+    {
+        return;
+    }
+    _loaded = true;
+
+    try
+    {
+        auto fs = FileStream(_path, FILE_MODE_OPEN);
+        auto header = fs.ReadValue<TrackPreviewCacheHeader>();
+        if (header.MagicNumber != TRACK_PREVIEW_CACHE_MAGIC_NUMBER ||
+            header.Version != TRACK_PREVIEW_CACHE_VERSION)
+        {
+            Reset();
+            return;
+        }
+
+        // Index the records, skipping over their pixel data
+        uint64 length = fs.GetLength();
+        _length = length;
+        while (fs.GetPosition() + sizeof(TrackPreviewCacheRecord) <= length)
+        {
+            uint64 offset = fs.GetPosition();
+            auto record = fs.ReadValue<TrackPreviewCacheRecord>();
+            if (fs.GetPosition() + record.DataLength > length)
+            {
+                break;
+            }
+            fs.Seek(record.DataLength, STREAM_SEEK_CURRENT);
+            _offsets[GetKey(record.FileHash, record.Context)] = offset;
+        }
+    }
+    catch (const Exception &)
+    {
+        // No cache yet
+    }
+}
+
+void TrackDesignPreviewCache::Reset()
+{
+    _offsets.clear();
+    _length = 0;
+    try
+    {
+        auto fs = FileStream(_path, FILE_MODE_WRITE);
+        TrackPreviewCacheHeader header = { 0 };
+        header.MagicNumber = TRACK_PREVIEW_CACHE_MAGIC_NUMBER;
+        header.Version = TRACK_PREVIEW_CACHE_VERSION;
+        fs.WriteValue(header);
+        _length = fs.GetLength();
+    }
+    catch (const Exception &)
+    {
+        Console::Error::WriteLine("Unable to write track design preview cache.");
+    }
+}
+
+/**
+ * FNV-1a hash of the file contents, so that previews follow the design rather than its path.
+ */
+uint64 TrackDesignPreviewCache::GetFileHash(const std::string &path)
+{
+    uint64 hash = 14695981039346656037ULL;
+    size_t length = 0;
+    uint8 * data = (uint8 *)File::ReadAllBytes(path, &length);
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    Memory::Free(data);
+    return hash;
+}
+
+uint64 TrackDesignPreviewCache::GetKey(uint64 fileHash, uint32 context)
+{
+    return (fileHash ^ context) * 1099511628211ULL;
+}
@@ -0,0 +1,53 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "../common.h"
+
+/**
+ * Stores the rendered previews of track designs on disk so that browsing the track list does not have to
+ * place and paint every design again. Previews are keyed by a hash of the design file and a context value
+ * that captures which objects were available when the preview was drawn.
+ */
+class TrackDesignPreviewCache final
+{
+private:
+    std::string _path;
+    bool _loaded = false;
+    uint64 _length = 0;
+    // Combined key -> file offset of the record
+    std::unordered_map<uint64, uint64> _offsets;
+
+public:
+    explicit TrackDesignPreviewCache(const std::string &path);
+
+    /**
+     * Looks up the preview of a design. The hash of the design file is returned through fileHash, or 0 if the
+     * file could not be read, so that a preview drawn after a miss can be stored without hashing it again.
+     */
+    bool Get(const std::string &trackPath, uint32 context, uint8 * pixels, money32 * cost, uint8 * flags, uint64 * fileHash);
+    void Set(uint64 fileHash, uint32 context, const uint8 * pixels, money32 cost, uint8 flags);
+
+private:
+    void Load();
+    void Reset();
+
+    static uint64 GetFileHash(const std::string &path);
+    static uint64 GetKey(uint64 fileHash, uint32 context);
+};
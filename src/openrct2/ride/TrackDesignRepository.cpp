@@ -28,6 +28,7 @@
 #include "../object/ObjectRepository.h"
 #include "../object/RideObject.h"
 #include "../PlatformEnvironment.h"
+#include "TrackDesignPreviewCache.h"
 #include "TrackDesignRepository.h"
 
 extern "C"
@@ -75,6 +76,7 @@ private:
 
     std::vector<TrackRepositoryItem> _items;
     QueryDirectoryResult _directoryQueryResult = { 0 };
+    std::unique_ptr<TrackDesignPreviewCache> _previewCache;
 
 public:
     TrackDesignRepository(IPlatformEnvironment * env)
@@ -82,6 +84,8 @@ public:
         Guard::ArgumentNotNull(env);
 
         _env = env;
+        _previewCache = std::unique_ptr<TrackDesignPreviewCache>(
+            new TrackDesignPreviewCache(env->GetFilePath(PATHID::CACHE_TRACK_PREVIEWS)));
     }
 
     virtual ~TrackDesignRepository() final
@@ -242,6 +246,16 @@ public:
         return result;
     }
 
+    bool GetPreview(const std::string &path, uint32 context, uint8 * pixels, money32 * cost, uint8 * flags, uint64 * fileHash) override
+    {
+        return _previewCache->Get(path, context, pixels, cost, flags, fileHash);
+    }
+
+    void SetPreview(uint64 fileHash, uint32 context, const uint8 * pixels, money32 cost, uint8 flags) override
+    {
+        _previewCache->Set(fileHash, context, pixels, cost, flags);
+    }
+
 private:
     void Query(const std::string &directory)
     {
@@ -448,6 +462,22 @@ extern "C"
         return !newPath.empty();
     }
 
+    bool track_repository_get_preview(const utf8 * path, uint32 context, uint8 * pixels, money32 * cost, uint8 * flags, uint64 * fileHash)
+    {
+        ITrackDesignRepository * repo = GetTrackDesignRepository();
+        *fileHash = 0;
+        return repo != nullptr && repo->GetPreview(path, context, pixels, cost, flags, fileHash);
+    }
+
+    void track_repository_set_preview(uint64 fileHash, uint32 context, const uint8 * pixels, money32 cost, uint8 flags)
+    {
+        ITrackDesignRepository * repo = GetTrackDesignRepository();
+        if (repo != nullptr)
+        {
+            repo->SetPreview(fileHash, context, pixels, cost, flags);
+        }
+    }
+
     utf8 * track_repository_get_name_from_path(const utf8 * path)
     {
         return String::Duplicate(TrackDesignRepository::GetNameFromTrackPath(path));
@@ -44,6 +44,9 @@ interface ITrackDesignRepository
     virtual bool Delete(const std::string &path) abstract;
     virtual std::string Rename(const std::string &path, const std::string &newName) abstract;
     virtual std::string Install(const std::string &path) abstract;
+
+    virtual bool GetPreview(const std::string &path, uint32 context, uint8 * pixels, money32 * cost, uint8 * flags, uint64 * fileHash) abstract;
+    virtual void SetPreview(uint64 fileHash, uint32 context, const uint8 * pixels, money32 cost, uint8 flags) abstract;
 };
 
 ITrackDesignRepository * CreateTrackDesignRepository(IPlatformEnvironment * env);
@@ -62,6 +65,8 @@ extern "C"
     bool    track_repository_delete(const utf8 *path);
     bool    track_repository_rename(const utf8 *path, const utf8 *newName);
     bool    track_repository_install(const utf8 *srcPath);
+    bool    track_repository_get_preview(const utf8 *path, uint32 context, uint8 *pixels, money32 *cost, uint8 *flags, uint64 *fileHash);
+    void    track_repository_set_preview(uint64 fileHash, uint32 context, const uint8 *pixels, money32 cost, uint8 flags);
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
 #include "../world/footpath.h"
 #include "../world/map.h"
 #include "../world/map_animation.h"
+#include "../world/ParkStats.h"
 #include "../world/scenery.h"
 #include "../world/sprite.h"
 #include "cable_lift.h"
@@ -5746,7 +5747,7 @@ static void ride_stop_peeps_queuing(sint32 rideIndex)
     }
 }
 
-static sint32 ride_get_empty_slot()
+sint32 ride_get_empty_slot()
 {
     for (sint32 i = 0; i < MAX_RIDES; i++) {
         rct_ride *ride = get_ride(i);
@@ -6174,8 +6175,8 @@ foundRideEntry:
     ride_set_vehicle_colours_to_random_preset(ride, 0xFF & (*outRideColour >> 8));
     window_invalidate_by_class(WC_RIDE_LIST);
 
-    // Log ride creation
-    if (network_get_mode() == NETWORK_MODE_SERVER) {
+    // Log ride creation, previews are never seen by the players
+    if (network_get_mode() == NETWORK_MODE_SERVER && !(flags & GAME_COMMAND_FLAG_5)) {
         int ebp = 1;
         game_log_multiplayer_command(GAME_COMMAND_CREATE_RIDE, 0, 0, 0, &rideIndex, 0, &ebp);
     }
@@ -6185,6 +6186,26 @@ foundRideEntry:
     return 0;
 }
 
+/**
+ * Creates the ride for a track design preview. This does not go through the game command path, so the ride is
+ * not sent over the network, recorded or charged for.
+ */
+bool ride_create_preview(sint32 type, sint32 subType, uint8 *outRideIndex)
+{
+    sint32 rideIndex, rideColour;
+    sint32 flags = GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_5;
+
+    // The first call picks the colours, as the command path does before applying
+    if (ride_create(type, subType, flags, &rideIndex, &rideColour) == MONEY32_UNDEFINED) {
+        return false;
+    }
+    if (ride_create(type, subType, flags | GAME_COMMAND_FLAG_APPLY, &rideIndex, &rideColour) == MONEY32_UNDEFINED) {
+        return false;
+    }
+    *outRideIndex = (uint8)rideIndex;
+    return true;
+}
+
 /**
  *
  *  rct2: 0x006B3F0F
@@ -6425,6 +6446,7 @@ void game_command_demolish_ride(sint32 *eax, sint32 *ebx, sint32 *ecx, sint32 *e
             user_string_free(ride->name);
             ride->type = RIDE_TYPE_NULL;
             window_invalidate_by_class(WC_RIDE_LIST);
+            park_stats_invalidate();
             gParkValue = calculate_park_value();
             gCommandPosition.x = x;
             gCommandPosition.y = y;
@@ -21,29 +21,35 @@
 #include "../localisation/string_ids.h"
 #include "../management/finance.h"
 #include "../network/network.h"
+#include "../paint/paint.h"
 #include "../object/ObjectManager.h"
 #include "../rct1.h"
 #include "../rct1/Tables.h"
 #include "../util/sawyercoding.h"
 #include "../util/util.h"
 #include "../windows/error.h"
+#include "../world/AmenityField.h"
 #include "../world/footpath.h"
+#include "../world/ParkStats.h"
 #include "../world/scenery.h"
 #include "ride.h"
 #include "ride_data.h"
+#include "RideIndex.h"
 #include "track.h"
 #include "track_data.h"
 #include "track_design.h"
 #include "TrackDesignRepository.h"
 
 typedef struct map_backup {
-    rct_map_element map_elements[MAX_MAP_ELEMENTS];
-    rct_map_element *tile_pointers[MAX_TILE_MAP_ELEMENT_POINTERS];
+    rct_map_element *map_elements;
+    rct_map_element **tile_pointers;
     rct_map_element *next_free_map_element;
     uint16 map_size_units;
     uint16 map_size_units_minus_2;
     uint16 map_size;
     uint8 current_rotation;
+    sint32 ride_index;              // Free ride slot the preview ride will be created in, or -1
+    rct_ride ride;
 } map_backup;
 
 rct_track_td6 *gActiveTrackDesign;
@@ -51,6 +57,8 @@ bool gTrackDesignSceneryToggle;
 rct_xyz16 gTrackPreviewMin;
 rct_xyz16 gTrackPreviewMax;
 rct_xyz16 gTrackPreviewOrigin;
+// Set while the map globals point at the scratch map of a track design preview
+bool gTrackDesignPreviewActive;
 
 uint8 byte_F4414E;
 bool byte_9D8150;
@@ -60,9 +68,14 @@ static money32 _trackDesignPlaceCost;
 static sint16 _trackDesignPlaceZ;
 static sint16 word_F44129;
 
+// Scratch map the previews are built in, allocated on first use and kept for reuse
+static rct_map_element *_previewMapElements;
+static rct_map_element **_previewMapElementTilePointers;
+
 static rct_track_td6 *track_design_open_from_buffer(uint8 *src, size_t srcLength);
-static map_backup *track_design_preview_backup_map();
+static bool track_design_preview_backup_map(map_backup *backup);
 static void track_design_preview_restore_map(map_backup *backup);
+static uint32 track_design_preview_get_context(rct_track_td6 *td6);
 static void track_design_preview_clear_map();
 
 static void td6_reset_trailing_elements(rct_track_td6 * td6);
@@ -1332,9 +1345,7 @@ static bool track_design_place_preview(rct_track_td6 *td6, money32 *cost, uint8
     }
 
     uint8 rideIndex;
-    uint8 colour;
-    uint8 rideCreateFlags = GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_5;
-    if (ride_create_command(td6->type, entry_index, rideCreateFlags, &rideIndex, &colour) == MONEY32_UNDEFINED) {
+    if (!ride_create_preview(td6->type, entry_index, &rideIndex)) {
         return false;
     }
 
@@ -1664,28 +1675,37 @@ void game_command_place_maze_design(sint32* eax, sint32* ebx, sint32* ecx, sint3
 #pragma region Track Design Preview
 
 /**
- *
+ * Draws the four rotations of a track design into pixels. If path is given, the result is looked up in and
+ * stored to the track repository's preview cache.
  *  rct2: 0x006D1EF0
  */
-void track_design_draw_preview(rct_track_td6 *td6, uint8 *pixels)
+void track_design_draw_preview(rct_track_td6 *td6, const utf8 *path, uint8 *pixels)
 {
-    // Make a copy of the map
-    map_backup *mapBackup = track_design_preview_backup_map();
-    if (mapBackup == NULL) {
-        return;
-    }
-    track_design_preview_clear_map();
-
     if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) {
         track_design_load_scenery_objects(td6);
     }
 
     money32 cost;
-    uint8 rideIndex;
     uint8 flags;
+    uint64 fileHash = 0;
+    uint32 context = track_design_preview_get_context(td6);
+    if (path != NULL && track_repository_get_preview(path, context, pixels, &cost, &flags, &fileHash)) {
+        td6->cost = cost;
+        td6->track_flags = flags;
+        return;
+    }
+
+    // Switch to the scratch map, the park map is left untouched
+    map_backup mapBackup;
+    if (!track_design_preview_backup_map(&mapBackup)) {
+        return;
+    }
+    track_design_preview_clear_map();
+
+    uint8 rideIndex;
     if (!track_design_place_preview(td6, &cost, &rideIndex, &flags)) {
         memset(pixels, 0, TRACK_PREVIEW_IMAGE_SIZE * 4);
-        track_design_preview_restore_map(mapBackup);
+        track_design_preview_restore_map(&mapBackup);
         return;
     }
     td6->cost = cost;
@@ -1757,60 +1777,95 @@ void track_design_draw_preview(rct_track_td6 *td6, uint8 *pixels)
     }
 
     ride_delete(rideIndex);
-    track_design_preview_restore_map(mapBackup);
+    track_design_preview_restore_map(&mapBackup);
+
+    if (path != NULL) {
+        track_repository_set_preview(fileHash, context, pixels, td6->cost, td6->track_flags);
+    }
 }
 
 /**
- * Create a backup of the map as it will be cleared for drawing the track
- * design preview.
+ * Points the map globals at the scratch map used for drawing the track design preview,
+ * remembering the park map so it can be switched back afterwards.
  *  rct2: 0x006D1C68
  */
-static map_backup *track_design_preview_backup_map()
+static bool track_design_preview_backup_map(map_backup *backup)
 {
-    map_backup *backup = malloc(sizeof(map_backup));
-    if (backup != NULL) {
-        memcpy(
-            backup->map_elements,
-            gMapElements,
-            sizeof(backup->map_elements)
-        );
-        memcpy(
-            backup->tile_pointers,
-            gMapElementTilePointers,
-            sizeof(backup->tile_pointers)
-        );
-        backup->next_free_map_element = gNextFreeMapElement;
-        backup->map_size_units = gMapSizeUnits;
-        backup->map_size_units_minus_2 = gMapSizeMinus2;
-        backup->map_size = gMapSize;
-        backup->current_rotation = get_current_rotation();
-    }
-    return backup;
+    if (_previewMapElements == NULL) {
+        _previewMapElements = malloc(MAX_MAP_ELEMENTS * sizeof(rct_map_element));
+        _previewMapElementTilePointers = malloc(MAX_TILE_MAP_ELEMENT_POINTERS * sizeof(rct_map_element*));
+        if (_previewMapElements == NULL || _previewMapElementTilePointers == NULL) {
+            SafeFree(_previewMapElements);
+            SafeFree(_previewMapElementTilePointers);
+            return false;
+        }
+    }
+
+    backup->map_elements = gMapElements;
+    backup->tile_pointers = gMapElementTilePointers;
+    backup->next_free_map_element = gNextFreeMapElement;
+    backup->map_size_units = gMapSizeUnits;
+    backup->map_size_units_minus_2 = gMapSizeMinus2;
+    backup->map_size = gMapSize;
+    backup->current_rotation = get_current_rotation();
+
+    // The preview ride takes the first free slot, keep it so the ride list is left exactly as it was
+    backup->ride_index = ride_get_empty_slot();
+    if (backup->ride_index != -1) {
+        backup->ride = *get_ride(backup->ride_index);
+    }
+
+    gMapElements = _previewMapElements;
+    gMapElementTilePointers = _previewMapElementTilePointers;
+    gTrackDesignPreviewActive = true;
+    return true;
 }
 
 /**
- * Restores the map from a backup.
+ * Switches the map globals back to the park map.
  *  rct2: 0x006D2378
  */
 static void track_design_preview_restore_map(map_backup *backup)
 {
-    memcpy(
-        gMapElements,
-        backup->map_elements,
-        sizeof(backup->map_elements)
-    );
-    memcpy(
-        gMapElementTilePointers,
-        backup->tile_pointers,
-        sizeof(backup->tile_pointers)
-    );
+    gMapElements = backup->map_elements;
+    gMapElementTilePointers = backup->tile_pointers;
     gNextFreeMapElement = backup->next_free_map_element;
     gMapSizeUnits = backup->map_size_units;
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
     gCurrentRotation = backup->current_rotation;
+    gTrackDesignPreviewActive = false;
+    if (backup->ride_index != -1) {
+        *get_ride(backup->ride_index) = backup->ride;
+    }
+
+    // Cached tiles were painted from the scratch map
+    paint_tile_cache_invalidate_all();
+    ride_index_invalidate();
+    amenity_field_invalidate();
+    park_stats_invalidate();
+    park_stats_invalidate_land();
+}
 
-    free(backup);
+/**
+ * Hashes the state outside of the design file that affects its preview, cost and flags so that
+ * cached previews are not reused once a different set of objects is loaded.
+ */
+static uint32 track_design_preview_get_context(rct_track_td6 *td6)
+{
+    uint32 context = 2166136261u;
+    context = (context ^ gScreenFlags) * 16777619u;
+    context = (context ^ ((gParkFlags & PARK_FLAGS_NO_MONEY) != 0)) * 16777619u;
+    context = (context ^ gTrackDesignSceneryToggle) * 16777619u;
+
+    uint8 entryType, entryIndex;
+    context = (context ^ find_object_in_entry_group(&td6->vehicle_object, &entryType, &entryIndex)) * 16777619u;
+
+    rct_td6_scenery_element *scenery = td6->scenery_elements;
+    for (; (scenery->scenery_object.flags & 0xFF) != 0xFF; scenery++) {
+        context = (context ^ find_object_in_entry_group(&scenery->scenery_object, &entryType, &entryIndex)) * 16777619u;
+    }
+    return context;
 }
 
 /**
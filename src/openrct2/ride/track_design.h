@@ -203,6 +203,7 @@ extern bool gTrackDesignSceneryToggle;
 extern rct_xyz16 gTrackPreviewMin;
 extern rct_xyz16 gTrackPreviewMax;
 extern rct_xyz16 gTrackPreviewOrigin;
+extern bool gTrackDesignPreviewActive;
 
 extern uint8 byte_F4414E;
 extern bool byte_9D8150;
@@ -223,7 +224,7 @@ void game_command_place_maze_design(sint32* eax, sint32* ebx, sint32* ecx, sint3
 ///////////////////////////////////////////////////////////////////////////////
 // Track design preview
 ///////////////////////////////////////////////////////////////////////////////
-void track_design_draw_preview(rct_track_td6 *td6, uint8 *pixels);
+void track_design_draw_preview(rct_track_td6 *td6, const utf8 *path, uint8 *pixels);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Track design saving
@@ -1601,6 +1601,7 @@ void track_paint_util_left_quarter_turn_1_tile_tunnel(uint8 direction, uint16 ba
 void track_paint_util_spinning_tunnel_paint(sint8 thickness, sint16 height, uint8 direction, uint8 rotation)
 {
 
+    paint_tile_cache_set_dynamic();
     sint32 frame = gScenarioTicks >> 2 & 3;
     uint32 colourFlags = gTrackColours[SCHEME_SUPPORTS];
 
@@ -1795,6 +1796,12 @@ void track_paint(uint8 direction, sint32 height, rct_map_element *mapElement)
 #ifndef NO_RCT2
         useOriginalRidePaint = gUseOriginalRidePaint;
 #endif
+
+        // Flat rides paint their vehicles as part of the track
+        if (useOriginalRidePaint || ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_FLAT_RIDE)) {
+            paint_tile_cache_set_dynamic();
+        }
+
         TRACK_PAINT_FUNCTION_GETTER paintFunctionGetter = RideTypeTrackPaintFunctions[ride->type];
         if (paintFunctionGetter != NULL && !useOriginalRidePaint) {
             TRACK_PAINT_FUNCTION paintFunction = paintFunctionGetter(trackType, direction);
@@ -210,6 +210,7 @@ static void chairlift_paint_station_ne_sw(uint8 rideIndex, uint8 trackSequence,
         imageId = SPR_FENCE_METAL_SW | gTrackColours[SCHEME_TRACK];
         sub_98197C(imageId, 0, 0, 1, 28, 27, height, 30, 2, height + 4, get_current_rotation());
 
+        paint_tile_cache_set_dynamic();
         imageId = chairlift_bullwheel_frames[ride->chairlift_bullwheel_rotation / 16384] | gTrackColours[SCHEME_TRACK];
         sub_98197C(imageId, 0, 0, 4, 4, 26, height, 14, 14, height + 4, get_current_rotation());
 
@@ -218,6 +219,7 @@ static void chairlift_paint_station_ne_sw(uint8 rideIndex, uint8 trackSequence,
 
         drawFrontColumn = false;
     } else if ((direction == 2 && isStart) || (direction == 0 && isEnd)) {
+        paint_tile_cache_set_dynamic();
         imageId = chairlift_bullwheel_frames[ride->chairlift_bullwheel_rotation / 16384] | gTrackColours[SCHEME_TRACK];
         sub_98197C(imageId, 0, 0, 4, 4, 26, height, 14, 14, height + 4, get_current_rotation());
 
@@ -286,6 +288,7 @@ static void chairlift_paint_station_se_nw(uint8 rideIndex, uint8 trackSequence,
     bool drawRightColumn = true;
     bool drawLeftColumn = true;
     if ((direction == 1 && isStart) || (direction == 3 && isEnd)) {
+        paint_tile_cache_set_dynamic();
         imageId = chairlift_bullwheel_frames[ride->chairlift_bullwheel_rotation / 16384] | gTrackColours[SCHEME_TRACK];
         sub_98197C(imageId, 0, 0, 4, 4, 26, height, 14, 14, height + 4, get_current_rotation());
 
@@ -297,6 +300,7 @@ static void chairlift_paint_station_se_nw(uint8 rideIndex, uint8 trackSequence,
         imageId = SPR_FENCE_METAL_SE | gTrackColours[SCHEME_TRACK];
         sub_98197C(imageId, 0, 0, 28, 1, 27, height, 2, 30, height + 4, get_current_rotation());
 
+        paint_tile_cache_set_dynamic();
         imageId = chairlift_bullwheel_frames[ride->chairlift_bullwheel_rotation / 16384] | gTrackColours[SCHEME_TRACK];
         sub_98197C(imageId, 0, 0, 4, 4, 26, height, 14, 14, height + 4, get_current_rotation());
 
@@ -543,55 +543,143 @@ static const rct_xy16 AvoidCollisionMoveOffset[] = {
     {  0, -1 },
 };
 
-static bool vehicle_move_info_valid(sint32 cd, sint32 typeAndDirection, sint32 offset)
+// Number of track type and direction entries in each gTrackVehicleInfo table
+static const uint16 VehicleMoveInfoTypeCounts[] = {
+    1024, 692, 404, 404, 404, 208, 208, 208, 208, 824, 824, 824, 824, 824, 824, 868, 868
+};
+static_assert(countof(VehicleMoveInfoTypeCounts) == countof(gTrackVehicleInfo), "VehicleMoveInfoTypeCounts needs a count for every gTrackVehicleInfo table");
+
+typedef struct vehicle_move_info_piece {
+    uint32 offset;
+    uint16 size;
+} vehicle_move_info_piece;
+
+/**
+ * The gTrackVehicleInfo lists are scattered through the track data and are reached through two levels of
+ * pointers. vehicle_move_info_init copies each distinct list once into _vehicleMoveInfo, and a flat table of
+ * pieces gives the offset and size of the list for every [cd][typeAndDirection], so that a car moving along a
+ * piece reads consecutive entries.
+ */
+static rct_vehicle_info *_vehicleMoveInfo = NULL;
+static vehicle_move_info_piece *_vehicleMoveInfoPieces = NULL;
+static uint32 _vehicleMoveInfoPieceStart[countof(VehicleMoveInfoTypeCounts)];
+static const rct_vehicle_info _vehicleMoveInfoZero = { 0 };
+
+static int vehicle_move_info_list_compare(const void *a, const void *b)
 {
-    if (cd >= countof(gTrackVehicleInfo)) {
-        return false;
+    uintptr_t listA = (uintptr_t)*(const rct_vehicle_info_list * const *)a;
+    uintptr_t listB = (uintptr_t)*(const rct_vehicle_info_list * const *)b;
+    return (listA > listB) - (listA < listB);
+}
+
+/**
+ * Builds the flat motion tables. Called once at startup.
+ * @returns false if the tables could not be allocated.
+ */
+bool vehicle_move_info_init()
+{
+    if (_vehicleMoveInfo != NULL) {
+        return true;
+    }
+
+    uint32 numPieces = 0;
+    for (size_t cd = 0; cd < countof(VehicleMoveInfoTypeCounts); cd++) {
+        _vehicleMoveInfoPieceStart[cd] = numPieces;
+        numPieces += VehicleMoveInfoTypeCounts[cd];
     }
-    sint32 size = 0;
-    switch (cd) {
-    case 0: size = 1024; break;
-    case 1: size = 692; break;
-    case 2: size = 404; break;
-    case 3: size = 404; break;
-    case 4: size = 404; break;
-    case 5: size = 208; break;
-    case 6: size = 208; break;
-    case 7: size = 208; break;
-    case 8: size = 208; break;
-    case 9: size = 824; break;
-    case 10: size = 824; break;
-    case 11: size = 824; break;
-    case 12: size = 824; break;
-    case 13: size = 824; break;
-    case 14: size = 824; break;
-    case 15: size = 868; break;
-    case 16: size = 868; break;
-    }
-    if (typeAndDirection >= size) {
+
+    // Many pieces share a list, so sort the lists to copy each one only once
+    const rct_vehicle_info_list **lists = malloc(numPieces * sizeof(*lists));
+    if (lists == NULL) {
+        log_error("Unable to allocate the vehicle motion tables.");
         return false;
     }
-    if (offset >= gTrackVehicleInfo[cd][typeAndDirection]->size) {
+    for (size_t cd = 0, i = 0; cd < countof(VehicleMoveInfoTypeCounts); cd++) {
+        for (size_t typeAndDirection = 0; typeAndDirection < VehicleMoveInfoTypeCounts[cd]; typeAndDirection++) {
+            lists[i++] = gTrackVehicleInfo[cd][typeAndDirection];
+        }
+    }
+    qsort(lists, numPieces, sizeof(*lists), vehicle_move_info_list_compare);
+
+    uint32 numInfos = 0;
+    uint32 numUniqueLists = 0;
+    for (uint32 i = 0; i < numPieces; i++) {
+        if (i == 0 || lists[i] != lists[i - 1]) {
+            lists[numUniqueLists++] = lists[i];
+            numInfos += lists[i]->size;
+        }
+    }
+
+    uint32 *listOffsets = malloc(numUniqueLists * sizeof(uint32));
+    rct_vehicle_info *moveInfo = malloc(max(numInfos, 1) * sizeof(rct_vehicle_info));
+    vehicle_move_info_piece *pieces = malloc(numPieces * sizeof(vehicle_move_info_piece));
+    if (listOffsets == NULL || moveInfo == NULL || pieces == NULL) {
+        log_error("Unable to allocate the vehicle motion tables.");
+        free(pieces);
+        free(moveInfo);
+        free(listOffsets);
+        free(lists);
         return false;
     }
+
+    for (uint32 i = 0, offset = 0; i < numUniqueLists; i++) {
+        listOffsets[i] = offset;
+        memcpy(&moveInfo[offset], lists[i]->info, lists[i]->size * sizeof(rct_vehicle_info));
+        offset += lists[i]->size;
+    }
+
+    for (size_t cd = 0; cd < countof(VehicleMoveInfoTypeCounts); cd++) {
+        for (size_t typeAndDirection = 0; typeAndDirection < VehicleMoveInfoTypeCounts[cd]; typeAndDirection++) {
+            const rct_vehicle_info_list *list = gTrackVehicleInfo[cd][typeAndDirection];
+            const rct_vehicle_info_list **found = bsearch(&list, lists, numUniqueLists, sizeof(*lists), vehicle_move_info_list_compare);
+            vehicle_move_info_piece *piece = &pieces[_vehicleMoveInfoPieceStart[cd] + typeAndDirection];
+            piece->offset = listOffsets[found - lists];
+            piece->size = list->size;
+        }
+    }
+
+    free(listOffsets);
+    free(lists);
+
+    _vehicleMoveInfo = moveInfo;
+    _vehicleMoveInfoPieces = pieces;
     return true;
 }
 
-const rct_vehicle_info *vehicle_get_move_info(sint32 cd, sint32 typeAndDirection, sint32 offset)
+/**
+ * Gets the piece for the given track and direction, or NULL if there is none.
+ */
+static const vehicle_move_info_piece *vehicle_get_move_info_piece(sint32 cd, sint32 typeAndDirection)
 {
-    if (!vehicle_move_info_valid(cd, typeAndDirection, offset)) {
-        static const rct_vehicle_info zero = { 0 };
-        return &zero;
+    if ((uint32)cd >= countof(VehicleMoveInfoTypeCounts)) {
+        return NULL;
     }
-    return &gTrackVehicleInfo[cd][typeAndDirection]->info[offset];
+    if ((uint32)typeAndDirection >= VehicleMoveInfoTypeCounts[cd]) {
+        return NULL;
+    }
+    if (_vehicleMoveInfo == NULL && !vehicle_move_info_init()) {
+        return NULL;
+    }
+    return &_vehicleMoveInfoPieces[_vehicleMoveInfoPieceStart[cd] + typeAndDirection];
 }
 
-uint16 vehicle_get_move_info_size(sint32 cd, sint32 typeAndDirection)
+static const rct_vehicle_info *vehicle_move_info_piece_get(const vehicle_move_info_piece *piece, sint32 offset)
 {
-    if (!vehicle_move_info_valid(cd, typeAndDirection, 0)) {
-        return 0;
+    if (piece == NULL || (uint32)offset >= piece->size) {
+        return &_vehicleMoveInfoZero;
     }
-    return gTrackVehicleInfo[cd][typeAndDirection]->size;
+    return &_vehicleMoveInfo[piece->offset + offset];
+}
+
+const rct_vehicle_info *vehicle_get_move_info(sint32 cd, sint32 typeAndDirection, sint32 offset)
+{
+    return vehicle_move_info_piece_get(vehicle_get_move_info_piece(cd, typeAndDirection), offset);
+}
+
+uint16 vehicle_get_move_info_size(sint32 cd, sint32 typeAndDirection)
+{
+    const vehicle_move_info_piece *piece = vehicle_get_move_info_piece(cd, typeAndDirection);
+    return piece == NULL ? 0 : piece->size;
 }
 
 const uint8 DoorOpenSoundIds[] = {
@@ -660,95 +748,171 @@ static void vehicle_invalidate(rct_vehicle *vehicle)
     invalidate_sprite_2((rct_sprite*)vehicle);
 }
 
+static bool vehicle_sound_is_audible(rct_vehicle *vehicle)
+{
+    if (vehicle->sound1_id == (uint8)-1 && vehicle->sound2_id == (uint8)-1) return false;
+    if (vehicle->sprite_left == (sint16)(uint16)0x8000) return false;
+
+    sint16 x = g_music_tracking_viewport->view_x;
+    sint16 y = g_music_tracking_viewport->view_y;
+    sint16 w = g_music_tracking_viewport->view_width / 4;
+    sint16 h = g_music_tracking_viewport->view_height / 4;
+    if (!gWindowAudioExclusive->classification) {
+        x -= w;
+        y -= h;
+    }
+    if (x >= vehicle->sprite_right || y >= vehicle->sprite_bottom) return false;
+
+    sint16 w2 = g_music_tracking_viewport->view_width + x;
+    sint16 h2 = g_music_tracking_viewport->view_height + y;
+    if (!gWindowAudioExclusive->classification) {
+        w2 += w + w;
+        h2 += h + h;
+    }
+    return w2 >= vehicle->sprite_left && h2 >= vehicle->sprite_top;
+}
+
 /**
  *
  *  rct2: 0x006BB9FF
  */
-static void vehicle_update_sound_params(rct_vehicle* vehicle)
+static void vehicle_update_sound_params(rct_vehicle_sound_params *i, rct_vehicle* vehicle, uint16 priority)
 {
-    if (!(gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) && (!(gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) || gS6Info.editor_step == EDITOR_STEP_ROLLERCOASTER_DESIGNER)) {
-        if (vehicle->sound1_id != (uint8)-1 || vehicle->sound2_id != (uint8)-1) {
-            if (vehicle->sprite_left != (sint16)(uint16)0x8000) {
-                sint16 x = g_music_tracking_viewport->view_x;
-                sint16 y = g_music_tracking_viewport->view_y;
-                sint16 w = g_music_tracking_viewport->view_width / 4;
-                sint16 h = g_music_tracking_viewport->view_height / 4;
-                if (!gWindowAudioExclusive->classification) {
-                    x -= w;
-                    y -= h;
-                }
-                if (x < vehicle->sprite_right && y < vehicle->sprite_bottom) {
-                    sint16 w2 = g_music_tracking_viewport->view_width + x;
-                    sint16 h2 = g_music_tracking_viewport->view_height + y;
-                    if (!gWindowAudioExclusive->classification) {
-                        w2 += w + w;
-                        h2 += h + h;
-                    }
-                    if (w2 >= vehicle->sprite_left && h2 >= vehicle->sprite_top) {
-                        uint16 v9 = sub_6BC2F3(vehicle);
-                        rct_vehicle_sound_params* i;
-                        for (i = &gVehicleSoundParamsList[0]; i < gVehicleSoundParamsListEnd && v9 <= i->var_A; i++);
-                        if (i < &gVehicleSoundParamsList[countof(gVehicleSoundParamsList)]) {
-                            if (gVehicleSoundParamsListEnd < &gVehicleSoundParamsList[countof(gVehicleSoundParamsList)]) {
-                                gVehicleSoundParamsListEnd++;
-                            }
-                            rct_vehicle_sound_params* j = gVehicleSoundParamsListEnd - 1;
-                            while (j > i) {
-                                j--;
-                                *(j + 1) = *j;
-                            }
-                            i->var_A = v9;
-                            sint32 pan_x = (vehicle->sprite_left / 2) + (vehicle->sprite_right / 2) - g_music_tracking_viewport->view_x;
-                            pan_x >>= g_music_tracking_viewport->zoom;
-                            pan_x += g_music_tracking_viewport->x;
-
-                            uint16 screenwidth = context_get_width();
-                            if (screenwidth < 64) {
-                                screenwidth = 64;
-                            }
-                            i->pan_x = ((((pan_x * 65536) / screenwidth) - 0x8000) >> 4);
+    i->var_A = priority;
+    sint32 pan_x = (vehicle->sprite_left / 2) + (vehicle->sprite_right / 2) - g_music_tracking_viewport->view_x;
+    pan_x >>= g_music_tracking_viewport->zoom;
+    pan_x += g_music_tracking_viewport->x;
 
-                            sint32 pan_y = (vehicle->sprite_top / 2) + (vehicle->sprite_bottom / 2) - g_music_tracking_viewport->view_y;
-                            pan_y >>= g_music_tracking_viewport->zoom;
-                            pan_y += g_music_tracking_viewport->y;
+    uint16 screenwidth = context_get_width();
+    if (screenwidth < 64) {
+        screenwidth = 64;
+    }
+    i->pan_x = ((((pan_x * 65536) / screenwidth) - 0x8000) >> 4);
 
-                            uint16 screenheight = context_get_height();
-                            if (screenheight < 64) {
-                                screenheight = 64;
-                            }
-                            i->pan_y = ((((pan_y * 65536) / screenheight) - 0x8000) >> 4);
+    sint32 pan_y = (vehicle->sprite_top / 2) + (vehicle->sprite_bottom / 2) - g_music_tracking_viewport->view_y;
+    pan_y >>= g_music_tracking_viewport->zoom;
+    pan_y += g_music_tracking_viewport->y;
 
-                            sint32 v = vehicle->velocity;
+    uint16 screenheight = context_get_height();
+    if (screenheight < 64) {
+        screenheight = 64;
+    }
+    i->pan_y = ((((pan_y * 65536) / screenheight) - 0x8000) >> 4);
 
-                            rct_ride_entry* ride_type = get_ride_entry(vehicle->ride_subtype);
-                            uint8 test = ride_type->vehicles[vehicle->vehicle_type].var_5A;
+    sint32 v = vehicle->velocity;
 
-                            if (test & 1) {
-                                v *= 2;
-                            }
-                            if (v < 0) {
-                                v = -v;
-                            }
-                            v >>= 5;
-                            v *= 5512;
-                            v >>= 14;
-                            v += 11025;
-                            v += 16 * vehicle->var_BF;
-                            i->frequency = (uint16)v;
-                            i->id = vehicle->sprite_index;
-                            i->volume = 0;
-                            if (vehicle->x != MAP_LOCATION_NULL) {
-                                rct_map_element* map_element = map_get_surface_element_at(vehicle->x >> 5, vehicle->y >> 5);
-                                if (map_element != NULL && map_element->base_height * 8 > vehicle->z) { // vehicle underground
-                                    i->volume = 0x30;
-                                }
-                            }
-                        }
-                    }
-                }
+    rct_ride_entry* ride_type = get_ride_entry(vehicle->ride_subtype);
+    uint8 test = ride_type->vehicles[vehicle->vehicle_type].var_5A;
+
+    if (test & 1) {
+        v *= 2;
+    }
+    if (v < 0) {
+        v = -v;
+    }
+    v >>= 5;
+    v *= 5512;
+    v >>= 14;
+    v += 11025;
+    v += 16 * vehicle->var_BF;
+    i->frequency = (uint16)v;
+    i->id = vehicle->sprite_index;
+    i->volume = 0;
+    if (vehicle->x != MAP_LOCATION_NULL) {
+        rct_map_element* map_element = map_get_surface_element_at(vehicle->x >> 5, vehicle->y >> 5);
+        if (map_element != NULL && map_element->base_height * 8 > vehicle->z) { // vehicle underground
+            i->volume = 0x30;
+        }
+    }
+}
+
+typedef struct vehicle_sound_candidate {
+    uint16 priority;
+    uint16 sprite_index;
+    uint32 order;
+} vehicle_sound_candidate;
+
+/**
+ * Whether a is dropped before b when there are more audible vehicles than sound slots. Of equal priorities the
+ * vehicle found later in the train list is dropped, as the original sorted list did.
+ */
+static bool vehicle_sound_candidate_is_worse(const vehicle_sound_candidate *a, const vehicle_sound_candidate *b)
+{
+    if (a->priority != b->priority) {
+        return a->priority < b->priority;
+    }
+    return a->order > b->order;
+}
+
+static void vehicle_sound_candidates_sift_down(vehicle_sound_candidate *heap, sint32 count, sint32 index)
+{
+    for (;;) {
+        sint32 worst = index;
+        sint32 left = index * 2 + 1;
+        sint32 right = left + 1;
+        if (left < count && vehicle_sound_candidate_is_worse(&heap[left], &heap[worst])) worst = left;
+        if (right < count && vehicle_sound_candidate_is_worse(&heap[right], &heap[worst])) worst = right;
+        if (worst == index) break;
+
+        vehicle_sound_candidate temp = heap[index];
+        heap[index] = heap[worst];
+        heap[worst] = temp;
+        index = worst;
+    }
+}
+
+static void vehicle_sound_candidates_sift_up(vehicle_sound_candidate *heap, sint32 index)
+{
+    while (index > 0) {
+        sint32 parent = (index - 1) / 2;
+        if (!vehicle_sound_candidate_is_worse(&heap[index], &heap[parent])) break;
+
+        vehicle_sound_candidate temp = heap[index];
+        heap[index] = heap[parent];
+        heap[parent] = temp;
+        index = parent;
+    }
+}
+
+/**
+ * Fills gVehicleSoundParamsList with the audible vehicles of highest priority, highest first. The candidates
+ * are kept in a heap with the one to drop next at the root, and the sound parameters are only worked out for
+ * the vehicles that get a slot.
+ */
+static void vehicle_sounds_select()
+{
+    vehicle_sound_candidate heap[AUDIO_MAX_VEHICLE_SOUNDS];
+    sint32 count = 0;
+    uint32 order = 0;
+
+    if (!(gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) && (!(gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) || gS6Info.editor_step == EDITOR_STEP_ROLLERCOASTER_DESIGNER)) {
+        for (uint16 i = gSpriteListHead[SPRITE_LIST_TRAIN]; i != SPRITE_INDEX_NULL; i = get_sprite(i)->vehicle.next) {
+            rct_vehicle *vehicle = &get_sprite(i)->vehicle;
+            if (!vehicle_sound_is_audible(vehicle)) continue;
+
+            vehicle_sound_candidate candidate = { (uint16)sub_6BC2F3(vehicle), i, order++ };
+            if (count < AUDIO_MAX_VEHICLE_SOUNDS) {
+                heap[count] = candidate;
+                vehicle_sound_candidates_sift_up(heap, count);
+                count++;
+            } else if (vehicle_sound_candidate_is_worse(&heap[0], &candidate)) {
+                heap[0] = candidate;
+                vehicle_sound_candidates_sift_down(heap, count, 0);
             }
         }
     }
+
+    // Take the worst off the heap each time to fill the list from the back
+    gVehicleSoundParamsListEnd = &gVehicleSoundParamsList[count];
+    while (count > 0) {
+        vehicle_sound_candidate candidate = heap[0];
+        count--;
+        heap[0] = heap[count];
+        vehicle_sound_candidates_sift_down(heap, count, 0);
+
+        rct_vehicle *vehicle = &get_sprite(candidate.sprite_index)->vehicle;
+        vehicle_update_sound_params(&gVehicleSoundParamsList[count], vehicle, candidate.priority);
+    }
 }
 
 /**
@@ -811,10 +975,7 @@ void vehicle_sounds_update()
                     }
                 }
             }
-            gVehicleSoundParamsListEnd = &gVehicleSoundParamsList[0];
-            for (uint16 i = gSpriteListHead[SPRITE_LIST_TRAIN]; i != SPRITE_INDEX_NULL; i = get_sprite(i)->vehicle.next) {
-                vehicle_update_sound_params(&get_sprite(i)->vehicle);
-            }
+            vehicle_sounds_select();
             for(sint32 i = 0; i < countof(gVehicleSoundList); i++){
                 rct_vehicle_sound* vehicle_sound = &gVehicleSoundList[i];
                 if (vehicle_sound->id != (uint16)-1) {
@@ -1060,7 +1221,9 @@ void vehicle_update_all()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gS6Info.editor_step != EDITOR_STEP_ROLLERCOASTER_DESIGNER)
         return;
 
-
+    // Trains must be updated one at a time in list order. Updates draw from scenario_rand, board and unload
+    // peeps, move sprites between quadrant lists and read the vehicles of other rides for collisions, so any
+    // other order, or updating rides concurrently, changes the simulation and desyncs multiplayer games.
     sprite_index = gSpriteListHead[SPRITE_LIST_TRAIN];
     while (sprite_index != SPRITE_INDEX_NULL) {
         vehicle = &(get_sprite(sprite_index)->vehicle);
@@ -5772,17 +5935,14 @@ bool vehicle_update_dodgems_collision(rct_vehicle *vehicle, sint16 x, sint16 y,
         location.x += Unk9A37C4[i].x;
         location.y += Unk9A37C4[i].y;
 
-        uint16 spriteIdx = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
+        uint16 spriteIdx = sprite_get_first_vehicle_in_quadrant(location.x * 32, location.y * 32);
         while (spriteIdx != SPRITE_INDEX_NULL) {
             rct_vehicle* vehicle2 = GET_VEHICLE(spriteIdx);
-            spriteIdx = vehicle2->next_in_quadrant;
+            spriteIdx = sprite_get_next_vehicle_in_quadrant(spriteIdx);
 
             if (vehicle2 == vehicle)
                 continue;
 
-            if (vehicle2->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE)
-                continue;
-
             if (vehicle2->ride != rideIndex)
                 continue;
 
@@ -7084,13 +7244,11 @@ static bool vehicle_update_motion_collision_detection(
         location.x += Unk9A37C4[i].x;
         location.y += Unk9A37C4[i].y;
 
-        collideId = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
-        for(; collideId != SPRITE_INDEX_NULL; collideId = collideVehicle->next_in_quadrant){
+        collideId = sprite_get_first_vehicle_in_quadrant(location.x * 32, location.y * 32);
+        for(; collideId != SPRITE_INDEX_NULL; collideId = sprite_get_next_vehicle_in_quadrant(collideId)){
             collideVehicle = GET_VEHICLE(collideId);
             if (collideVehicle == vehicle) continue;
 
-            if (collideVehicle->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE) continue;
-
             sint32 z_diff = abs(collideVehicle->z - z);
 
             if (z_diff > 16) continue;
@@ -7561,30 +7719,22 @@ loc_6DAEB9:
 
     regs.ax = vehicle->track_progress + 1;
 
-    const rct_vehicle_info *moveInfo = vehicle_get_move_info(
-        vehicle->var_CD,
-        vehicle->track_type,
-        0
-        );
-
-    // Track Total Progress is in the two bytes before the move info list
-    uint16 trackTotalProgress = vehicle_get_move_info_size(vehicle->var_CD, vehicle->track_type);
+    // The piece only changes when the car moves onto the next track element
+    const vehicle_move_info_piece *piece = vehicle_get_move_info_piece(vehicle->var_CD, vehicle->track_type);
+    uint16 trackTotalProgress = piece == NULL ? 0 : piece->size;
     if (regs.ax >= trackTotalProgress) {
         if (!vehicle_update_track_motion_forwards_get_new_track(vehicle, trackType, ride, rideEntry)) {
             goto loc_6DB94A;
         }
         regs.ax = 0;
+        piece = vehicle_get_move_info_piece(vehicle->var_CD, vehicle->track_type);
     }
 
     vehicle->track_progress = regs.ax;
     vehicle_update_handle_water_splash(vehicle);
 
     // loc_6DB706
-    moveInfo = vehicle_get_move_info(
-        vehicle->var_CD,
-        vehicle->track_type,
-        vehicle->track_progress
-        );
+    const rct_vehicle_info *moveInfo = vehicle_move_info_piece_get(piece, vehicle->track_progress);
     sint16 x = vehicle->track_x + moveInfo->x;
     sint16 y = vehicle->track_y + moveInfo->y;
     sint16 z = vehicle->track_z + moveInfo->z + RideData5[ride->type].z_offset;
@@ -612,6 +612,7 @@ static void paint_river_rapids_track_waterfall(uint8 rideIndex, uint8 trackSeque
 {
     uint32 imageId;
 
+    paint_tile_cache_set_dynamic();
     uint16 frameNum = (gScenarioTicks / 2) & 7;
 
     if (direction & 1) {
@@ -663,6 +664,7 @@ static void paint_river_rapids_track_rapids(uint8 rideIndex, uint8 trackSequence
 {
     uint32 imageId;
 
+    paint_tile_cache_set_dynamic();
     uint16 frameNum = (gScenarioTicks / 2) & 7;
 
     if (direction & 1) {
@@ -704,6 +706,7 @@ static void paint_river_rapids_track_whirlpool(uint8 rideIndex, uint8 trackSeque
 {
     uint32 imageId;
 
+    paint_tile_cache_set_dynamic();
     uint8 frameNum = (gScenarioTicks / 4) % 16;
 
     if (direction & 1) {
@@ -30,15 +30,19 @@
 #include "../object.h"
 #include "../object_list.h"
 #include "../OpenRCT2.h"
+#include "../peep/peep.h"
 #include "../peep/staff.h"
 #include "../platform/platform.h"
 #include "../rct1.h"
 #include "../ride/ride.h"
+#include "../ride/RideIndex.h"
 #include "../util/sawyercoding.h"
 #include "../util/util.h"
+#include "../world/AmenityField.h"
 #include "../world/Climate.h"
 #include "../world/map.h"
 #include "../world/park.h"
+#include "../world/ParkStats.h"
 #include "../world/scenery.h"
 #include "../world/sprite.h"
 #include "../world/water.h"
@@ -139,6 +143,11 @@ void scenario_begin()
 
     gScreenFlags = SCREEN_FLAGS_PLAYING;
     audio_stop_all_music_and_sounds();
+    ride_index_invalidate();
+    amenity_field_invalidate();
+    park_stats_invalidate();
+    park_stats_invalidate_land();
+    peep_sort_names_invalidate();
     viewport_init_all();
     game_create_windows();
     mainWindow = window_get_main();
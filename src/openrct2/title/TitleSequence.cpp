@@ -134,29 +134,35 @@ extern "C"
         TitleSequenceParkHandle * handle = nullptr;
         if (index <= seq->NumSaves)
         {
-            const utf8 * filename = seq->Saves[index];
-            if (seq->IsZip)
-            {
-                IZipArchive * zip = Zip::TryOpen(seq->Path, ZIP_ACCESS_READ);
-                if (zip != nullptr)
-                {
-                    handle = Memory::Allocate<TitleSequenceParkHandle>();
-                    handle->Stream = zip->GetFileStream(filename);
-                    handle->HintPath = String::Duplicate(filename);
-                    delete zip;
-                }
-            }
-            else
-            {
-                utf8 absolutePath[MAX_PATH];
-                String::Set(absolutePath, sizeof(absolutePath), seq->Path);
-                Path::Append(absolutePath, sizeof(absolutePath), filename);
+            handle = TitleSequenceOpenPark(seq->Path, seq->IsZip, seq->Saves[index]);
+        }
+        return handle;
+    }
 
+    TitleSequenceParkHandle * TitleSequenceOpenPark(const utf8 * sequencePath, bool isZip, const utf8 * filename)
+    {
+        TitleSequenceParkHandle * handle = nullptr;
+        if (isZip)
+        {
+            IZipArchive * zip = Zip::TryOpen(sequencePath, ZIP_ACCESS_READ);
+            if (zip != nullptr)
+            {
                 handle = Memory::Allocate<TitleSequenceParkHandle>();
-                handle->Stream = new FileStream(absolutePath, FILE_MODE_OPEN);
+                handle->Stream = zip->GetFileStream(filename);
                 handle->HintPath = String::Duplicate(filename);
+                delete zip;
             }
         }
+        else
+        {
+            utf8 absolutePath[MAX_PATH];
+            String::Set(absolutePath, sizeof(absolutePath), sequencePath);
+            Path::Append(absolutePath, sizeof(absolutePath), filename);
+
+            handle = Memory::Allocate<TitleSequenceParkHandle>();
+            handle->Stream = new FileStream(absolutePath, FILE_MODE_OPEN);
+            handle->HintPath = String::Duplicate(filename);
+        }
         return handle;
     }
 
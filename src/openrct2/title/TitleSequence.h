@@ -89,6 +89,11 @@ extern "C"
 
     TitleSequenceParkHandle * TitleSequenceGetParkHandle(TitleSequence * seq, size_t index);
 
+    /**
+     * Opens a park of a title sequence without needing the sequence itself, so it can be used off the main thread.
+     */
+    TitleSequenceParkHandle * TitleSequenceOpenPark(const utf8 * sequencePath, bool isZip, const utf8 * filename);
+
     /**
      * Close a title sequence park handle.
      * The pointer to the handle is invalid after calling this function.
@@ -15,14 +15,17 @@
 #pragma endregion
 
 #include <memory>
+#include <thread>
 #include "../common.h"
 #include "../core/Console.hpp"
 #include "../core/Exception.hpp"
 #include "../core/Guard.hpp"
+#include "../core/IStream.hpp"
 #include "../core/Math.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../ParkImporter.h"
+#include "../rct12/SawyerChunkReader.h"
 #include "../scenario/ScenarioRepository.h"
 #include "../scenario/ScenarioSources.h"
 #include "TitleSequence.h"
@@ -35,6 +38,10 @@ extern "C"
     #include "../interface/viewport.h"
     #include "../interface/window.h"
     #include "../management/news_item.h"
+    #include "../peep/peep.h"
+    #include "../ride/RideIndex.h"
+    #include "../scenario/scenario.h"
+    #include "../world/AmenityField.h"
     #include "../world/scenery.h"
 }
 
@@ -54,6 +61,13 @@ private:
     sint32          _lastScreenHeight = 0;
     rct_xy32        _viewCentreLocation = { 0 };
 
+    // The park of the next load command, read and decoded on a background thread
+    std::thread                     _prefetchThread;
+    sint32                          _prefetchPosition = -1;
+    std::string                     _prefetchFileName;
+    TitleSequenceParkHandle *       _prefetchParkHandle = nullptr;
+    std::unique_ptr<IParkImporter>  _prefetchImporter;
+
 public:
     TitleSequencePlayer(IScenarioRepository * scenarioRepository)
     {
@@ -74,6 +88,7 @@ public:
 
     void Eject() override
     {
+        CancelPrefetch();
         FreeTitleSequence(_sequence);
         _sequence = nullptr;
     }
@@ -282,13 +297,20 @@ private:
         {
             bool loadSuccess = false;
             uint8 saveIndex = command->SaveIndex;
-            TitleSequenceParkHandle * parkHandle = TitleSequenceGetParkHandle(_sequence, saveIndex);
-            if (parkHandle != nullptr)
+            if (!TryLoadPrefetchedPark(saveIndex, &loadSuccess))
+            {
+                TitleSequenceParkHandle * parkHandle = TitleSequenceGetParkHandle(_sequence, saveIndex);
+                if (parkHandle != nullptr)
+                {
+                    loadSuccess = LoadParkFromStream((IStream *)parkHandle->Stream, parkHandle->HintPath);
+                    TitleSequenceCloseParkHandle(parkHandle);
+                }
+            }
+            if (loadSuccess)
             {
-                loadSuccess = LoadParkFromStream((IStream *)parkHandle->Stream, parkHandle->HintPath);
-                TitleSequenceCloseParkHandle(parkHandle);
+                BeginPrefetch();
             }
-            if (!loadSuccess)
+            else
             {
                 if (_sequence->NumSaves > saveIndex)
                 {
@@ -394,6 +416,138 @@ private:
         return success;
     }
 
+    /**
+     * Starts reading the park of the next load command after the current position on a background thread,
+     * so that reaching it only has to import the already decoded park.
+     */
+    void BeginPrefetch()
+    {
+        CancelPrefetch();
+
+        sint32 position = _position;
+        const TitleCommand * command;
+        do
+        {
+            position = (position + 1) % (sint32)_sequence->NumCommands;
+            command = &_sequence->Commands[position];
+        }
+        while (!TitleSequenceIsLoadCommand(command) && position != _position);
+
+        if (command->Type != TITLE_SCRIPT_LOAD || command->SaveIndex >= _sequence->NumSaves)
+        {
+            return;
+        }
+
+        _prefetchPosition = position;
+        _prefetchFileName = _sequence->Saves[command->SaveIndex];
+        std::string sequencePath = _sequence->Path;
+        bool isZip = _sequence->IsZip;
+        _prefetchThread = std::thread([this, sequencePath, isZip]() -> void
+        {
+            TitleSequenceParkHandle * parkHandle = nullptr;
+            try
+            {
+                parkHandle = TitleSequenceOpenPark(sequencePath.c_str(), isZip, _prefetchFileName.c_str());
+                if (parkHandle != nullptr && parkHandle->Stream != nullptr)
+                {
+                    IStream * stream = (IStream *)parkHandle->Stream;
+                    std::string hintPath = parkHandle->HintPath;
+                    if (HasPackedObjects(stream, hintPath))
+                    {
+                        // Packed objects are added to the object repository, which is left to the main thread
+                        _prefetchParkHandle = parkHandle;
+                        parkHandle = nullptr;
+                    }
+                    else
+                    {
+                        bool isScenario = ParkImporter::ExtensionIsScenario(hintPath);
+                        auto parkImporter = std::unique_ptr<IParkImporter>(ParkImporter::Create(hintPath));
+                        parkImporter->LoadFromStream(stream, isScenario);
+                        _prefetchImporter = std::move(parkImporter);
+                    }
+                }
+            }
+            catch (const Exception &)
+            {
+                // The park is loaded again when its command is reached, which reports the error
+            }
+            catch (...)
+            {
+                // Anything else escaping the thread would terminate the game, so drop the prefetch instead
+                _prefetchImporter = nullptr;
+            }
+            TitleSequenceCloseParkHandle(parkHandle);
+        });
+    }
+
+    void CancelPrefetch()
+    {
+        if (_prefetchThread.joinable())
+        {
+            _prefetchThread.join();
+        }
+        TitleSequenceCloseParkHandle(_prefetchParkHandle);
+        _prefetchParkHandle = nullptr;
+        _prefetchImporter = nullptr;
+        _prefetchPosition = -1;
+        _prefetchFileName.clear();
+    }
+
+    /**
+     * Finishes loading the prefetched park if it is the one for the current load command.
+     * @return false if the park was not prefetched and has to be loaded normally.
+     */
+    bool TryLoadPrefetchedPark(uint8 saveIndex, bool * outSuccess)
+    {
+        bool result = false;
+        if (_prefetchPosition == _position &&
+            saveIndex < _sequence->NumSaves &&
+            String::Equals(_prefetchFileName.c_str(), _sequence->Saves[saveIndex]))
+        {
+            if (_prefetchThread.joinable())
+            {
+                _prefetchThread.join();
+            }
+            if (_prefetchImporter != nullptr)
+            {
+                log_verbose("TitleSequencePlayer::TryLoadPrefetchedPark(%s)", _prefetchFileName.c_str());
+                try
+                {
+                    _prefetchImporter->Import();
+                    PrepareParkForPlayback();
+                    *outSuccess = true;
+                }
+                catch (const Exception &)
+                {
+                    Console::Error::WriteLine("Unable to load park: %s", _prefetchFileName.c_str());
+                    *outSuccess = false;
+                }
+                result = true;
+            }
+            else if (_prefetchParkHandle != nullptr)
+            {
+                *outSuccess = LoadParkFromStream((IStream *)_prefetchParkHandle->Stream, _prefetchParkHandle->HintPath);
+                result = true;
+            }
+        }
+        CancelPrefetch();
+        return result;
+    }
+
+    static bool HasPackedObjects(IStream * stream, const std::string &hintPath)
+    {
+        if (ParkImporter::ExtensionIsRCT1(Path::GetExtension(hintPath)))
+        {
+            return false;
+        }
+
+        uint64 position = stream->GetPosition();
+        auto chunkReader = SawyerChunkReader(stream);
+        auto header = chunkReader.ReadChunkAs<rct_s6_header>();
+        stream->SetPosition(position);
+        return header.num_packed_objects != 0;
+    }
+
     void PrepareParkForPlayback()
     {
         rct_window * w = window_get_main();
@@ -424,6 +578,9 @@ private:
         window_invalidate(w);
         reset_sprite_spatial_index();
         reset_all_sprite_quadrant_placements();
+        ride_index_invalidate();
+        amenity_field_invalidate();
+        peep_sort_names_invalidate();
         window_new_ride_init_vars();
         scenery_set_default_placement_configuration();
         news_item_init_queue();
@@ -372,7 +372,7 @@ static void window_install_track_text_input(rct_window *w, rct_widgetindex widge
 
 static void window_install_track_update_preview()
 {
-    track_design_draw_preview(_trackDesign, _trackDesignPreviewPixels);
+    track_design_draw_preview(_trackDesign, _trackPath, _trackDesignPreviewPixels);
 }
 
 static void window_install_track_design(rct_window *w)
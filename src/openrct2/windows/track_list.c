@@ -631,7 +631,7 @@ static bool track_list_load_design_for_preview(utf8 *path)
 
     _loadedTrackDesign = track_design_open(path);
     if (_loadedTrackDesign != NULL && drawing_engine_get_type() != DRAWING_ENGINE_OPENGL) {
-        track_design_draw_preview(_loadedTrackDesign, _trackDesignPreviewPixels);
+        track_design_draw_preview(_loadedTrackDesign, path, _trackDesignPreviewPixels);
         return true;
     }
     return false;
@@ -0,0 +1,255 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include <vector>
+#include "../core/Math.hpp"
+#include "AmenityField.h"
+
+extern "C"
+{
+    #include "footpath.h"
+    #include "map.h"
+    #include "scenery.h"
+    #include "sprite.h"
+}
+
+/**
+ * Every guest walking around regularly assesses the scenery, path items and litter around them. Instead of
+ * walking every map element near the guest and all the litter in the park each time, the counts are kept for
+ * the surroundings of every tile. The map element counts are built on the next query after a game command or a
+ * load, while litter and vandalism update them as they happen. Ghost elements, such as the scenery previewed
+ * under the cursor, are not counted so that the ghost commands placing them every tick keep the counts.
+ */
+
+constexpr sint32 FIELD_SIZE = MAXIMUM_MAP_SIZE_TECHNICAL;
+
+// The surroundings of a tile span from 5 tiles before it to 4 tiles after it
+constexpr sint32 TILE_RANGE_BEFORE = 5;
+constexpr sint32 TILE_RANGE_AFTER = 4;
+constexpr sint32 LITTER_RANGE = 160;
+
+static bool _amenityFieldValid = false;
+static amenity_counts _amenityField[FIELD_SIZE * FIELD_SIZE];
+
+static void AddElementCounts(amenity_counts * counts, rct_map_element * mapElement, sint32 sign)
+{
+    if (mapElement->flags & MAP_ELEMENT_FLAG_GHOST)
+        return;
+
+    switch (map_element_get_type(mapElement)) {
+    case MAP_ELEMENT_TYPE_PATH:
+    {
+        if (!footpath_element_has_path_scenery(mapElement))
+            break;
+
+        rct_scenery_entry * sceneryEntry = get_footpath_item_entry(footpath_element_get_path_scenery_index(mapElement));
+        if (sceneryEntry == nullptr)
+        {
+            counts->invalid_path_items += sign;
+            break;
+        }
+        if (footpath_element_path_scenery_is_ghost(mapElement))
+            break;
+
+        if (sceneryEntry->path_bit.flags & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
+        {
+            counts->fountains += sign;
+        }
+        else if (mapElement->flags & MAP_ELEMENT_FLAG_BROKEN)
+        {
+            counts->broken_path_items += sign;
+        }
+        break;
+    }
+    case MAP_ELEMENT_TYPE_SCENERY_MULTIPLE:
+    case MAP_ELEMENT_TYPE_SCENERY:
+        counts->scenery += sign;
+        break;
+    }
+}
+
+static void AddCounts(amenity_counts * dst, const amenity_counts * src, sint32 sign)
+{
+    dst->scenery += sign * src->scenery;
+    dst->fountains += sign * src->fountains;
+    dst->broken_path_items += sign * src->broken_path_items;
+    dst->invalid_path_items += sign * src->invalid_path_items;
+    dst->litter += sign * src->litter;
+}
+
+/**
+ * Adds the counts of a tile to the surroundings of every tile that can see it.
+ */
+static void AddTileCounts(sint32 tileX, sint32 tileY, const amenity_counts * counts, sint32 sign)
+{
+    sint32 left = Math::Max(tileX - TILE_RANGE_AFTER, 0);
+    sint32 top = Math::Max(tileY - TILE_RANGE_AFTER, 0);
+    sint32 right = Math::Min(tileX + TILE_RANGE_BEFORE, FIELD_SIZE - 1);
+    sint32 bottom = Math::Min(tileY + TILE_RANGE_BEFORE, FIELD_SIZE - 1);
+    for (sint32 y = top; y <= bottom; y++)
+    {
+        for (sint32 x = left; x <= right; x++)
+        {
+            AddCounts(&_amenityField[x + y * FIELD_SIZE], counts, sign);
+        }
+    }
+}
+
+/**
+ * Gets the range of tiles whose corner is within the litter range of the given coordinate.
+ */
+static void GetLitterTileRange(sint32 coordinate, sint32 * first, sint32 * last)
+{
+    *first = Math::Max(coordinate - LITTER_RANGE + 31, 0) / 32;
+    *last = Math::Min((coordinate + LITTER_RANGE) / 32, FIELD_SIZE - 1);
+}
+
+static void AddLitter(sint32 x, sint32 y, sint32 sign)
+{
+    if (x == SPRITE_LOCATION_NULL)
+        return;
+
+    sint32 left, top, right, bottom;
+    GetLitterTileRange(x, &left, &right);
+    GetLitterTileRange(y, &top, &bottom);
+    for (sint32 tileY = top; tileY <= bottom; tileY++)
+    {
+        for (sint32 tileX = left; tileX <= right; tileX++)
+        {
+            _amenityField[tileX + tileY * FIELD_SIZE].litter += sign;
+        }
+    }
+}
+
+/**
+ * Sums the counts of every tile into the surroundings of each tile with a summed-area table, one count at a time.
+ */
+static void SumSurroundings(const std::vector<amenity_counts> &tileCounts, uint16 amenity_counts::*count)
+{
+    constexpr sint32 stride = FIELD_SIZE + 1;
+    std::vector<uint32> sums(stride * stride, 0);
+    for (sint32 y = 0; y < FIELD_SIZE; y++)
+    {
+        for (sint32 x = 0; x < FIELD_SIZE; x++)
+        {
+            sums[(x + 1) + (y + 1) * stride] =
+                tileCounts[x + y * FIELD_SIZE].*count +
+                sums[x + (y + 1) * stride] +
+                sums[(x + 1) + y * stride] -
+                sums[x + y * stride];
+        }
+    }
+
+    for (sint32 y = 0; y < FIELD_SIZE; y++)
+    {
+        sint32 top = Math::Max(y - TILE_RANGE_BEFORE, 0);
+        sint32 bottom = Math::Min(y + TILE_RANGE_AFTER, FIELD_SIZE - 1) + 1;
+        for (sint32 x = 0; x < FIELD_SIZE; x++)
+        {
+            sint32 left = Math::Max(x - TILE_RANGE_BEFORE, 0);
+            sint32 right = Math::Min(x + TILE_RANGE_AFTER, FIELD_SIZE - 1) + 1;
+            // Counts wrap around the same way as summing the tiles one by one into a uint16 would
+            _amenityField[x + y * FIELD_SIZE].*count = (uint16)(
+                sums[right + bottom * stride] -
+                sums[left + bottom * stride] -
+                sums[right + top * stride] +
+                sums[left + top * stride]);
+        }
+    }
+}
+
+static void AmenityFieldBuild()
+{
+    std::vector<amenity_counts> tileCounts(FIELD_SIZE * FIELD_SIZE, amenity_counts());
+    for (sint32 y = 0; y < FIELD_SIZE; y++)
+    {
+        for (sint32 x = 0; x < FIELD_SIZE; x++)
+        {
+            amenity_counts * counts = &tileCounts[x + y * FIELD_SIZE];
+            rct_map_element * mapElement = map_get_first_element_at(x, y);
+            do
+            {
+                AddElementCounts(counts, mapElement, 1);
+            }
+            while (!map_element_is_last_for_tile(mapElement++));
+        }
+    }
+
+    SumSurroundings(tileCounts, &amenity_counts::scenery);
+    SumSurroundings(tileCounts, &amenity_counts::fountains);
+    SumSurroundings(tileCounts, &amenity_counts::broken_path_items);
+    SumSurroundings(tileCounts, &amenity_counts::invalid_path_items);
+
+    for (auto &counts : _amenityField)
+    {
+        counts.litter = 0;
+    }
+    rct_litter * litter;
+    for (uint16 spriteIndex = gSpriteListHead[SPRITE_LIST_LITTER]; spriteIndex != SPRITE_INDEX_NULL; spriteIndex = litter->next)
+    {
+        litter = &(get_sprite(spriteIndex)->litter);
+        AddLitter(litter->x, litter->y, 1);
+    }
+
+    _amenityFieldValid = true;
+}
+
+extern "C"
+{
+    void amenity_field_invalidate()
+    {
+        _amenityFieldValid = false;
+    }
+
+    const amenity_counts * amenity_field_get(sint32 x, sint32 y)
+    {
+        if (!_amenityFieldValid)
+        {
+            AmenityFieldBuild();
+        }
+        return &_amenityField[(x >> 5) + (y >> 5) * FIELD_SIZE];
+    }
+
+    void amenity_field_remove_element(sint32 tileX, sint32 tileY, rct_map_element * mapElement)
+    {
+        if (!_amenityFieldValid) return;
+
+        amenity_counts counts = {};
+        AddElementCounts(&counts, mapElement, 1);
+        AddTileCounts(tileX, tileY, &counts, -1);
+    }
+
+    void amenity_field_add_element(sint32 tileX, sint32 tileY, rct_map_element * mapElement)
+    {
+        if (!_amenityFieldValid) return;
+
+        amenity_counts counts = {};
+        AddElementCounts(&counts, mapElement, 1);
+        AddTileCounts(tileX, tileY, &counts, 1);
+    }
+
+    void amenity_field_remove_litter(sint32 x, sint32 y)
+    {
+        if (!_amenityFieldValid) return;
+        AddLitter(x, y, -1);
+    }
+
+    void amenity_field_add_litter(sint32 x, sint32 y)
+    {
+        if (!_amenityFieldValid) return;
+        AddLitter(x, y, 1);
+    }
+}
@@ -0,0 +1,51 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#pragma once
+
+#include "../common.h"
+
+typedef struct rct_map_element rct_map_element;
+
+/**
+ * What a guest standing on a tile can see around them, as assessed by peep_assess_surroundings: the non-ghost map
+ * elements on the 10x10 tiles from 5 tiles before to 4 tiles after the tile, and the litter within 160 units of
+ * its corner.
+ */
+typedef struct amenity_counts {
+    uint16 scenery;
+    uint16 fountains;
+    uint16 broken_path_items;
+    uint16 invalid_path_items;  // Path items of which the object is not loaded
+    uint16 litter;
+} amenity_counts;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    void amenity_field_invalidate();
+    const amenity_counts * amenity_field_get(sint32 x, sint32 y);
+
+    /** Keeps the counts up to date for a map element changed outside of a game command, before and after the change. */
+    void amenity_field_remove_element(sint32 tileX, sint32 tileY, rct_map_element * mapElement);
+    void amenity_field_add_element(sint32 tileX, sint32 tileY, rct_map_element * mapElement);
+
+    void amenity_field_remove_litter(sint32 x, sint32 y);
+    void amenity_field_add_litter(sint32 x, sint32 y);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,240 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include "../core/Memory.hpp"
+#include "ParkStats.h"
+
+extern "C"
+{
+    #include "../game.h"
+    #include "../peep/peep.h"
+    #include "../peep/staff.h"
+    #include "../ride/ride.h"
+    #include "../ride/ride_data.h"
+    #include "map.h"
+    #include "sprite.h"
+}
+
+/**
+ * The park rating, park value, daily profit and each award used to walk the guests and rides on their own. The
+ * totals they need are now counted together in a single pass and shared. They are recounted on the next request
+ * after the game logic or a game command had the chance to change the park, so the results are the same as
+ * counting at the time of the call.
+ */
+
+static bool _parkStatsValid = false;
+static park_stats _parkStats;
+
+static bool _ownedTilesValid = false;
+static sint32 _ownedTiles;
+
+static const uint8 DazzlingRideColours[] = { 5, 14, 20, 30 };
+
+static void ParkStatsCountPeeps(park_stats * stats)
+{
+    uint16 spriteIndex;
+    rct_peep * peep;
+    FOR_ALL_PEEPS(spriteIndex, peep)
+    {
+        if (peep->type == PEEP_TYPE_STAFF)
+        {
+            stats->staff++;
+            stats->staff_type_flags |= (1 << peep->staff_type);
+            if (peep->staff_type < STAFF_TYPE_COUNT)
+            {
+                stats->staff_by_type[peep->staff_type]++;
+            }
+            continue;
+        }
+
+        stats->guests++;
+        if (peep->outside_of_park != 0)
+            continue;
+
+        stats->guests_in_park++;
+        if (peep->happiness > 128)
+            stats->happy_guests++;
+        if ((peep->peep_flags & PEEP_FLAGS_LEAVING_PARK) && (peep->peep_is_lost_countdown < 90))
+            stats->lost_guests++;
+        if (peep->thoughts[0].var_2 <= 5)
+            stats->recent_thoughts[peep->thoughts[0].type]++;
+    }
+}
+
+static bool RideIsOpen(const rct_ride * ride)
+{
+    return ride->status == RIDE_STATUS_OPEN && !(ride->lifecycle_flags & RIDE_LIFECYCLE_CRASHED);
+}
+
+static money32 GetRideValue(const rct_ride * ride)
+{
+    if (ride->value == RIDE_VALUE_UNDEFINED)
+        return 0;
+
+    // Fair value * (...)
+    return (ride->value * 10) * (ride_customers_in_last_5_minutes(ride) + rideBonusValue[ride->type] * 4);
+}
+
+static void ParkStatsCountRides(park_stats * stats)
+{
+    uint64 foodStallItems = 0;
+    sint32 i;
+    rct_ride * ride;
+    FOR_ALL_RIDES(i, ride)
+    {
+        stats->rides++;
+        stats->total_ride_uptime += 100 - ride->downtime;
+        if (ride->excitement != RIDE_RATING_UNDEFINED)
+        {
+            stats->total_ride_excitement += ride->excitement / 8;
+            stats->total_ride_intensity += ride->intensity / 8;
+            stats->rated_rides++;
+        }
+        stats->total_ride_value += GetRideValue(ride);
+        if (ride->status != RIDE_STATUS_CLOSED && ride->upkeep_cost != -1)
+        {
+            stats->total_ride_upkeep += 2 * ride->upkeep_cost;
+        }
+        if (ride->last_crash_type != RIDE_CRASH_TYPE_NONE)
+        {
+            stats->any_ride_crashed = true;
+        }
+
+        rct_ride_entry * rideEntry = get_ride_entry(ride->subtype);
+        if (rideEntry != nullptr && RideIsOpen(ride))
+        {
+            const uint8 * category = rideEntry->category;
+            if (category[0] == RIDE_GROUP_ROLLERCOASTER || category[1] == RIDE_GROUP_ROLLERCOASTER)
+                stats->open_rollercoasters++;
+            if (category[0] == RIDE_GROUP_WATER || category[1] == RIDE_GROUP_WATER)
+                stats->open_water_rides++;
+            if (category[0] == RIDE_GROUP_GENTLE || category[1] == RIDE_GROUP_GENTLE)
+                stats->open_gentle_rides++;
+        }
+
+        if (ride->status == RIDE_STATUS_OPEN)
+        {
+            if (ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_SELLS_FOOD))
+            {
+                stats->open_food_stalls++;
+                if (rideEntry != nullptr && !(foodStallItems & (1ULL << rideEntry->shop_item)))
+                {
+                    foodStallItems |= (1ULL << rideEntry->shop_item);
+                    stats->open_food_stall_items++;
+                }
+            }
+            if (ride->type == RIDE_TYPE_TOILETS)
+            {
+                stats->open_restrooms++;
+            }
+        }
+
+        if (ride->excitement != RIDE_RATING_UNDEFINED && ride->popularity != 0xFF)
+        {
+            stats->popular_rides_counted++;
+            if (ride->popularity <= 6)
+                stats->unpopular_rides++;
+        }
+
+        if (ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_HAS_TRACK))
+        {
+            if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN) &&
+                ride->excitement >= RIDE_RATING(5, 50) &&
+                RideIsOpen(ride))
+            {
+                stats->open_custom_designed_rides++;
+            }
+
+            stats->track_rides++;
+            for (uint8 colour : DazzlingRideColours)
+            {
+                if (ride->track_colour_main[0] == colour)
+                {
+                    stats->dazzling_track_rides++;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void ParkStatsCountLitter(park_stats * stats)
+{
+    rct_litter * litter;
+    for (uint16 spriteIndex = gSpriteListHead[SPRITE_LIST_LITTER]; spriteIndex != SPRITE_INDEX_NULL; spriteIndex = litter->next)
+    {
+        litter = &(get_sprite(spriteIndex)->litter);
+
+        // Ignore recently dropped litter
+        if (litter->creationTick - gScenarioTicks >= 7680)
+            stats->old_litter++;
+    }
+}
+
+static sint32 CountOwnedTiles()
+{
+    sint32 tiles = 0;
+    map_element_iterator it;
+    map_element_iterator_begin(&it);
+    do
+    {
+        if (map_element_get_type(it.element) == MAP_ELEMENT_TYPE_SURFACE)
+        {
+            if (it.element->properties.surface.ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+            {
+                tiles++;
+            }
+        }
+    }
+    while (map_element_iterator_next(&it));
+    return tiles;
+}
+
+extern "C"
+{
+    const park_stats * park_stats_get()
+    {
+        if (!_parkStatsValid)
+        {
+            Memory::Set(&_parkStats, 0, sizeof(park_stats));
+            ParkStatsCountPeeps(&_parkStats);
+            ParkStatsCountRides(&_parkStats);
+            ParkStatsCountLitter(&_parkStats);
+            _parkStatsValid = true;
+        }
+        return &_parkStats;
+    }
+
+    void park_stats_invalidate()
+    {
+        _parkStatsValid = false;
+    }
+
+    sint32 park_stats_get_owned_tiles()
+    {
+        if (!_ownedTilesValid)
+        {
+            _ownedTiles = CountOwnedTiles();
+            _ownedTilesValid = true;
+        }
+        return _ownedTiles;
+    }
+
+    void park_stats_invalidate_land()
+    {
+        _ownedTilesValid = false;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma region Copyright (c) 2014-2017 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#pragma once
+
+#include "../common.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    #include "../peep/staff.h"
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * Totals over the guests, staff, rides and litter of the park, as counted by the park rating, park value, daily
+ * profit and award checks.
+ */
+typedef struct park_stats {
+    // Guests
+    sint32 guests;                      // All guests, including those outside the park
+    sint32 guests_in_park;
+    sint32 happy_guests;                // Guests in the park with happiness above 128
+    sint32 lost_guests;                 // Guests in the park who can't find the exit
+    uint16 recent_thoughts[256];        // Guests in the park whose newest thought (var_2 <= 5) is of each type
+
+    // Staff
+    sint32 staff;
+    sint32 staff_type_flags;
+    uint16 staff_by_type[STAFF_TYPE_COUNT];
+
+    // Rides
+    sint32 rides;
+    sint32 rated_rides;                 // Rides with an excitement rating
+    sint16 total_ride_uptime;
+    sint16 total_ride_excitement;       // Sum of excitement / 8 of rated rides
+    sint16 total_ride_intensity;        // Sum of intensity / 8 of rated rides
+    money32 total_ride_value;
+    money32 total_ride_upkeep;          // Twice the upkeep of each ride that is not closed
+    bool any_ride_crashed;
+
+    uint16 open_rollercoasters;
+    uint16 open_water_rides;
+    uint16 open_gentle_rides;
+    uint16 open_custom_designed_rides;  // Custom track designs with excitement of at least 5.50
+    uint16 open_food_stalls;
+    uint16 open_food_stall_items;       // Unique items sold by open food stalls
+    uint16 open_restrooms;
+
+    uint16 popular_rides_counted;       // Rides with excitement and popularity known
+    uint16 unpopular_rides;             // ...of which popularity is 6 or less
+    uint16 track_rides;
+    uint16 dazzling_track_rides;        // Track rides with a dazzling main colour
+
+    // Litter
+    sint32 old_litter;                  // Litter that was not dropped recently
+} park_stats;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    /**
+     * Gets the totals for the current state of the park. They are counted on the first call after the last
+     * invalidation and reused until the next one.
+     */
+    const park_stats * park_stats_get();
+    void park_stats_invalidate();
+
+    /** Gets the number of surface tiles owned or with construction rights owned, counted as for park_stats_get. */
+    sint32 park_stats_get_owned_tiles();
+    void park_stats_invalidate_land();
+#ifdef __cplusplus
+}
+#endif
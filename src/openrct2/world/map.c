@@ -27,18 +27,22 @@
 #include "../management/finance.h"
 #include "../network/network.h"
 #include "../OpenRCT2.h"
+#include "../paint/paint.h"
 #include "../rct2.h"
 #include "../ride/ride_data.h"
+#include "../ride/RideIndex.h"
 #include "../ride/track.h"
 #include "../ride/track_data.h"
 #include "../scenario/scenario.h"
 #include "../util/util.h"
+#include "AmenityField.h"
 #include "banner.h"
 #include "Climate.h"
 #include "footpath.h"
 #include "map.h"
 #include "map_animation.h"
 #include "park.h"
+#include "ParkStats.h"
 #include "scenery.h"
 #include "tile_inspector.h"
 
@@ -94,8 +98,10 @@ sint16 gMapSizeMaxXY;
 sint16 gMapBaseZ;
 
 #if defined(NO_RCT2)
-rct_map_element gMapElements[MAX_TILE_MAP_ELEMENT_POINTERS * 3];
-rct_map_element *gMapElementTilePointers[MAX_TILE_MAP_ELEMENT_POINTERS];
+static rct_map_element _mapElements[MAX_TILE_MAP_ELEMENT_POINTERS * 3];
+static rct_map_element *_mapElementTilePointers[MAX_TILE_MAP_ELEMENT_POINTERS];
+rct_map_element *gMapElements = _mapElements;
+rct_map_element **gMapElementTilePointers = _mapElementTilePointers;
 #else
 rct_map_element *gMapElements = RCT2_ADDRESS(RCT2_ADDRESS_MAP_ELEMENTS, rct_map_element);
 rct_map_element **gMapElementTilePointers = RCT2_ADDRESS(RCT2_ADDRESS_TILE_MAP_ELEMENT_POINTERS, rct_map_element*);
@@ -497,6 +503,11 @@ void map_update_tile_pointers()
     }
 
     gNextFreeMapElement = mapElement;
+
+    paint_tile_cache_invalidate_all();
+    ride_index_invalidate();
+    amenity_field_invalidate();
+    park_stats_invalidate_land();
 }
 
 /**
@@ -3397,6 +3408,7 @@ rct_map_element *map_element_insert(sint32 x, sint32 y, sint32 z, sint32 flags)
 
     // Set tile index pointer to point to new element block
     gMapElementTilePointers[y * MAXIMUM_MAP_SIZE_TECHNICAL + x] = newMapElement;
+    paint_tile_cache_invalidate_tile(x, y);
 
     // Copy all elements that are below the insert height
     while (z >= originalMapElement->base_height) {
@@ -4221,6 +4233,9 @@ rct_xy32 translate_3d_to_2d_with_z(sint32 rotation, rct_xyz32 pos)
 
 static void map_invalidate_tile_under_zoom(sint32 x, sint32 y, sint32 z0, sint32 z1, sint32 maxZoom)
 {
+    // Cached paint structs are shared by all zoom levels
+    paint_tile_cache_invalidate_tile(x >> 5, y >> 5);
+
     if (gOpenRCT2Headless) return;
 
     sint32 x1, y1, x2, y2;
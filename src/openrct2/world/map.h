@@ -371,13 +371,9 @@ extern uint8        gMapSelectArrowDirection;
 
 extern uint8 gMapGroundFlags;
 
-#ifdef NO_RCT2
-extern rct_map_element gMapElements[];
-extern rct_map_element *gMapElementTilePointers[];
-#else
+// Pointers rather than arrays so that the track design preview can temporarily swap in its own map
 extern rct_map_element *gMapElements;
 extern rct_map_element **gMapElementTilePointers;
-#endif
 
 extern rct_xy16 gMapSelectionTiles[300];
 extern rct2_peep_spawn gPeepSpawns[MAX_PEEP_SPAWNS];
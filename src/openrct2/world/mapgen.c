@@ -117,6 +117,53 @@ static void set_height(sint32 x, sint32 y, sint32 height)
         _height[x + y * _heightSize] = height;
 }
 
+#define MAPGEN_MAX_THREADS 16
+
+typedef void (*mapgen_rows_func)(void *context, sint32 startY, sint32 endY);
+
+typedef struct mapgen_row_band {
+    mapgen_rows_func func;
+    void *context;
+    sint32 startY, endY;
+} mapgen_row_band;
+
+static int mapgen_row_band_thread(void *data)
+{
+    mapgen_row_band *band = (mapgen_row_band*)data;
+    band->func(band->context, band->startY, band->endY);
+    return 0;
+}
+
+/**
+ * Splits the rows from startY up to endY into bands and calls func for each band on its own thread. func must
+ * only write to the rows it is given, so the result does not depend on how the rows are split. The calling
+ * thread takes the first band itself and any band whose thread could not be started.
+ */
+static void mapgen_for_each_row_band(sint32 startY, sint32 endY, mapgen_rows_func func, void *context)
+{
+    sint32 numCpus = SDL_GetCPUCount();
+    sint32 numBands = clamp(1, numCpus, min(MAPGEN_MAX_THREADS, endY - startY));
+
+    mapgen_row_band bands[MAPGEN_MAX_THREADS];
+    SDL_Thread *threads[MAPGEN_MAX_THREADS] = { NULL };
+    for (sint32 i = 0; i < numBands; i++) {
+        bands[i].func = func;
+        bands[i].context = context;
+        bands[i].startY = startY + ((endY - startY) * i) / numBands;
+        bands[i].endY = startY + ((endY - startY) * (i + 1)) / numBands;
+    }
+    for (sint32 i = 1; i < numBands; i++) {
+        threads[i] = SDL_CreateThread(mapgen_row_band_thread, "mapgen", &bands[i]);
+        if (threads[i] == NULL)
+            mapgen_row_band_thread(&bands[i]);
+    }
+    mapgen_row_band_thread(&bands[0]);
+    for (sint32 i = 1; i < numBands; i++) {
+        if (threads[i] != NULL)
+            SDL_WaitThread(threads[i], NULL);
+    }
+}
+
 void mapgen_generate_blank(mapgen_settings *settings)
 {
     sint32 x, y;
@@ -264,10 +311,30 @@ static void mapgen_place_tree(sint32 type, sint32 x, sint32 y)
  */
 static void mapgen_place_trees()
 {
-    sint32 numGrassTreeIds = 0, numDesertTreeIds = 0, numSnowTreeIds = 0;
-    sint32 *grassTreeIds = (sint32*)malloc(countof(GrassTrees) * sizeof(sint32));
-    sint32 *desertTreeIds = (sint32*)malloc(countof(DesertTrees) * sizeof(sint32));
-    sint32 *snowTreeIds = (sint32*)malloc(countof(SnowTrees) * sizeof(sint32));
+    enum { TREE_GRASS, TREE_DESERT, TREE_SNOW, TREE_CATEGORY_COUNT };
+    static const struct { const char * const *names; size_t count; } treeCategories[TREE_CATEGORY_COUNT] = {
+        { GrassTrees, countof(GrassTrees) },
+        { DesertTrees, countof(DesertTrees) },
+        { SnowTrees, countof(SnowTrees) },
+    };
+
+    // Flatten the tree lists into one lookup so each scenery entry only needs a single scan. Entries are
+    // kept in category order so a name listed twice resolves to the same category as before.
+    struct { char name[8]; uint8 category; } treeLookup[countof(GrassTrees) + countof(DesertTrees) + countof(SnowTrees)];
+    size_t numTreeLookup = 0;
+    for (sint32 c = 0; c < TREE_CATEGORY_COUNT; c++) {
+        for (size_t j = 0; j < treeCategories[c].count; j++) {
+            memcpy(treeLookup[numTreeLookup].name, treeCategories[c].names[j], 8);
+            treeLookup[numTreeLookup].category = c;
+            numTreeLookup++;
+        }
+    }
+
+    sint32 numTreeIds[TREE_CATEGORY_COUNT] = { 0 };
+    sint32 grassTreeIds[countof(GrassTrees)];
+    sint32 desertTreeIds[countof(DesertTrees)];
+    sint32 snowTreeIds[countof(SnowTrees)];
+    sint32 *treeIds[TREE_CATEGORY_COUNT] = { grassTreeIds, desertTreeIds, snowTreeIds };
 
     for (sint32 i = 0; i < object_entry_group_counts[OBJECT_TYPE_SMALL_SCENERY]; i++) {
         rct_scenery_entry *sceneryEntry = get_small_scenery_entry(i);
@@ -276,32 +343,23 @@ static void mapgen_place_trees()
         if (sceneryEntry == (rct_scenery_entry*)-1 || sceneryEntry == NULL)
             continue;
 
-        sint32 j;
-        for (j = 0; j < countof(GrassTrees); j++)
-            if (strncmp(GrassTrees[j], entry->name, 8) == 0)
-                break;
-        if (j != countof(GrassTrees)) {
-            grassTreeIds[numGrassTreeIds++] = i;
-            continue;
-        }
-
-        for (j = 0; j < countof(DesertTrees); j++)
-            if (strncmp(DesertTrees[j], entry->name, 8) == 0)
-                break;
-        if (j != countof(DesertTrees)) {
-            desertTreeIds[numDesertTreeIds++] = i;
+        // All tree names start with 'T', skip everything else without scanning the table
+        if (entry->name[0] != 'T')
             continue;
-        }
 
-        for (j = 0; j < countof(SnowTrees); j++)
-            if (strncmp(SnowTrees[j], entry->name, 8) == 0)
+        for (size_t j = 0; j < numTreeLookup; j++) {
+            if (strncmp(treeLookup[j].name, entry->name, 8) == 0) {
+                sint32 category = treeLookup[j].category;
+                treeIds[category][numTreeIds[category]++] = i;
                 break;
-        if (j != countof(SnowTrees)) {
-            snowTreeIds[numSnowTreeIds++] = i;
-            continue;
+            }
         }
     }
 
+    sint32 numGrassTreeIds = numTreeIds[TREE_GRASS];
+    sint32 numDesertTreeIds = numTreeIds[TREE_DESERT];
+    sint32 numSnowTreeIds = numTreeIds[TREE_SNOW];
+
     sint32 availablePositionsCount = 0;
     struct { sint32 x; sint32 y; } tmp, *pos, *availablePositions;
     availablePositions = malloc(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL * sizeof(tmp));
@@ -374,9 +432,6 @@ static void mapgen_place_trees()
     }
 
     free(availablePositions);
-    free(grassTreeIds);
-    free(desertTreeIds);
-    free(snowTreeIds);
 }
 
 /**
@@ -586,30 +641,59 @@ static void mapgen_blob(sint32 cx, sint32 cy, sint32 size, sint32 height)
     mapgen_blob_fill(height);
 }
 
+typedef struct smooth_height_pass {
+    const uint8 *src;
+    uint8 *dst;
+} smooth_height_pass;
+
+static void mapgen_smooth_height_rows(void *context, sint32 startY, sint32 endY)
+{
+    const smooth_height_pass *pass = (const smooth_height_pass*)context;
+    const sint32 size = _heightSize;
+    uint16 columnSums[MAXIMUM_MAP_SIZE_TECHNICAL * 2];
+
+    for (sint32 y = startY; y < endY; y++) {
+        const uint8 *above = &pass->src[(y - 1) * size];
+        const uint8 *row = &pass->src[y * size];
+        const uint8 *below = &pass->src[(y + 1) * size];
+        for (sint32 x = 0; x < size; x++)
+            columnSums[x] = above[x] + row[x] + below[x];
+
+        uint8 *out = &pass->dst[y * size];
+        sint32 sum = columnSums[0] + columnSums[1] + columnSums[2];
+        for (sint32 x = 1; x < size - 1; x++) {
+            out[x] = sum / 9;
+            if (x + 2 < size)
+                sum += columnSums[x + 2] - columnSums[x - 1];
+        }
+    }
+}
+
 /**
  * Smooths the height map.
+ * Each pass reads from one buffer and writes to the other, so the rows can be smoothed on several threads and the
+ * 3x3 average can be computed from running column sums instead of re-reading all nine neighbours per tile. The
+ * edges are never written to, so both buffers keep the same border throughout.
  */
 static void mapgen_smooth_height(sint32 iterations)
 {
-    sint32 i, x, y, xx, yy, avg;
     sint32 arraySize = _heightSize * _heightSize * sizeof(uint8);
-    uint8 *copyHeight = malloc(arraySize);
-
-    for (i = 0; i < iterations; i++) {
-        memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize - 1; y++) {
-            for (x = 1; x < _heightSize - 1; x++) {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
-                    for (xx = -1; xx <= 1; xx++)
-                        avg += copyHeight[(y + yy) * _heightSize + (x + xx)];
-                avg /= 9;
-                set_height(x, y, avg);
-            }
-        }
+    uint8 *src = _height;
+    uint8 *dst = malloc(arraySize);
+
+    memcpy(dst, src, arraySize);
+    for (sint32 i = 0; i < iterations; i++) {
+        smooth_height_pass pass = { src, dst };
+        mapgen_for_each_row_band(1, _heightSize - 1, mapgen_smooth_height_rows, &pass);
+
+        uint8 *tmp = src;
+        src = dst;
+        dst = tmp;
     }
 
-    free(copyHeight);
+    if (src != _height)
+        memcpy(_height, src, arraySize);
+    free(src == _height ? dst : src);
 }
 
 /**
@@ -670,15 +754,37 @@ static void noise_rand()
         perm[i] = util_rand() & 0xFF;
 }
 
-static float fractal_noise(sint32 x, sint32 y, float frequency, sint32 octaves, float lacunarity, float persistence)
+#define NOISE_MAX_OCTAVES 32
+
+typedef struct noise_params {
+    sint32 octaves;
+    float frequencies[NOISE_MAX_OCTAVES];
+    float amplitudes[NOISE_MAX_OCTAVES];
+} noise_params;
+
+/**
+ * Precomputes the frequency and amplitude of each octave. The values are accumulated in the same order as the
+ * per-tile loop used to, so the noise is bit-for-bit the same.
+ */
+static void noise_params_init(noise_params *params, float frequency, sint32 octaves, float lacunarity, float persistence)
 {
-    float total = 0.0f;
     float amplitude = persistence;
-    for (sint32 i = 0; i < octaves; i++) {
-        total += generate(x * frequency, y * frequency) * amplitude;
+    params->octaves = min(octaves, NOISE_MAX_OCTAVES);
+    for (sint32 i = 0; i < params->octaves; i++) {
+        params->frequencies[i] = frequency;
+        params->amplitudes[i] = amplitude;
         frequency *= lacunarity;
         amplitude *= persistence;
     }
+}
+
+static float fractal_noise(sint32 x, sint32 y, const noise_params *params)
+{
+    float total = 0.0f;
+    for (sint32 i = 0; i < params->octaves; i++) {
+        float frequency = params->frequencies[i];
+        total += generate(x * frequency, y * frequency) * params->amplitudes[i];
+    }
     return total;
 }
 
@@ -761,25 +867,36 @@ static float grad(sint32 hash, float x, float y)
     return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
 }
 
-static void mapgen_simplex(mapgen_settings *settings)
+typedef struct simplex_job {
+    const noise_params *params;
+    sint32 low, high;
+} simplex_job;
+
+static void mapgen_simplex_rows(void *context, sint32 startY, sint32 endY)
 {
-    sint32 x, y;
+    const simplex_job *job = (const simplex_job*)context;
+    for (sint32 y = startY; y < endY; y++) {
+        uint8 *row = &_height[y * _heightSize];
+        for (sint32 x = 0; x < _heightSize; x++) {
+            float noiseValue = clamp(-1.0f, fractal_noise(x, y, job->params), 1.0f);
+            float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
-    float freq = settings->simplex_base_freq * (1.0f / _heightSize);
-    sint32 octaves = settings->simplex_octaves;
+            row[x] = (uint8)(job->low + (sint32)(normalisedNoiseValue * job->high));
+        }
+    }
+}
 
-    sint32 low = settings->simplex_low;
-    sint32 high = settings->simplex_high;
+static void mapgen_simplex(mapgen_settings *settings)
+{
+    noise_params params;
+    noise_params_init(&params, settings->simplex_base_freq * (1.0f / _heightSize), settings->simplex_octaves, 2.0f, 0.65f);
 
     noise_rand();
-    for (y = 0; y < _heightSize; y++) {
-        for (x = 0; x < _heightSize; x++) {
-            float noiseValue = clamp(-1.0f, fractal_noise(x, y, freq, octaves, 2.0f, 0.65f), 1.0f);
-            float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
-            set_height(x, y, low + (sint32)(normalisedNoiseValue * high));
-        }
-    }
+    // Every tile only depends on its own coordinates and the permutation table, so the rows can be split
+    // between threads without changing the result
+    simplex_job job = { &params, settings->simplex_low, settings->simplex_high };
+    mapgen_for_each_row_band(0, _heightSize, mapgen_simplex_rows, &job);
 }
 
 #pragma endregion
@@ -789,20 +906,16 @@ static void mapgen_simplex(mapgen_settings *settings)
 bool mapgen_load_heightmap(const utf8 *path)
 {
     const char* extension = path_get_extension(path);
-    uint8 *pixels;
-    size_t pitch;
-    uint32 numChannels;
+    uint8 *monoPixels;
     uint32 width, height;
 
     if (strcicmp(extension, ".png") == 0) {
-        if (!image_io_png_read(&pixels, &width, &height, path)) {
+        // The PNG reader averages the channels row by row while decoding
+        if (!image_io_png_read_mono(&monoPixels, &width, &height, path)) {
             log_warning("Error reading PNG");
             window_error_open(STR_HEIGHT_MAP_ERROR, STR_ERROR_READING_PNG);
             return false;
         }
-
-        numChannels = 4;
-        pitch = width * numChannels;
     }
     else if (strcicmp(extension, ".bmp") == 0) {
         SDL_Surface *bitmap = SDL_LoadBMP(path);
@@ -814,8 +927,7 @@ bool mapgen_load_heightmap(const utf8 *path)
 
         width = bitmap->w;
         height = bitmap->h;
-        numChannels = bitmap->format->BytesPerPixel;
-        pitch = bitmap->pitch;
+        uint32 numChannels = bitmap->format->BytesPerPixel;
 
         if (numChannels < 3 || bitmap->format->BitsPerPixel < 24)
         {
@@ -824,10 +936,18 @@ bool mapgen_load_heightmap(const utf8 *path)
             return false;
         }
 
-        // Copy pixels over, then discard the surface
+        // Average the channels straight from the surface, then discard it
+        monoPixels = malloc(width * height);
         SDL_LockSurface(bitmap);
-        pixels = malloc(height * bitmap->pitch);
-        memcpy(pixels, bitmap->pixels, height * bitmap->pitch);
+        for (uint32 y = 0; y < height; y++)
+        {
+            const uint8 *src = (const uint8*)bitmap->pixels + y * bitmap->pitch;
+            uint8 *dst = &monoPixels[y * width];
+            for (uint32 x = 0; x < width; x++, src += numChannels)
+            {
+                dst[x] = (src[0] + src[1] + src[2]) / 3;
+            }
+        }
         SDL_UnlockSurface(bitmap);
         SDL_FreeSurface(bitmap);
     }
@@ -839,34 +959,26 @@ bool mapgen_load_heightmap(const utf8 *path)
 
     if (width != height) {
         window_error_open(STR_HEIGHT_MAP_ERROR, STR_ERROR_WIDTH_AND_HEIGHT_DO_NOT_MATCH);
-        free(pixels);
+        free(monoPixels);
         return false;
     }
 
     if (width > MAXIMUM_MAP_SIZE_PRACTICAL) {
         window_error_open(STR_HEIGHT_MAP_ERROR, STR_ERROR_HEIHGT_MAP_TOO_BIG);
-        width = height = min(height, MAXIMUM_MAP_SIZE_PRACTICAL);
-    }
-
-    // Allocate memory for the height map values, one byte pixel
-    free(_heightMapData.mono_bitmap);
-    _heightMapData.mono_bitmap = (uint8*)malloc(width * height);
-    _heightMapData.width = width;
-    _heightMapData.height = height;
 
-    // Copy average RGB value to mono bitmap
-    for (uint32 x = 0; x < _heightMapData.width; x++)
-    {
-        for (uint32 y = 0; y < _heightMapData.height; y++)
+        // Crop to the top left corner. Rows only move towards the start of the buffer, so this can be done in place.
+        uint32 croppedSize = MAXIMUM_MAP_SIZE_PRACTICAL;
+        for (uint32 y = 1; y < croppedSize; y++)
         {
-            const uint8 red = pixels[x * numChannels + y * pitch];
-            const uint8 green = pixels[x * numChannels + y * pitch + 1];
-            const uint8 blue = pixels[x * numChannels + y * pitch + 2];
-            _heightMapData.mono_bitmap[x + y * _heightMapData.width] = (red + green + blue) / 3;
+            memmove(&monoPixels[y * croppedSize], &monoPixels[y * width], croppedSize);
         }
+        width = height = croppedSize;
     }
 
-    free(pixels);
+    free(_heightMapData.mono_bitmap);
+    _heightMapData.mono_bitmap = monoPixels;
+    _heightMapData.width = width;
+    _heightMapData.height = height;
     return true;
 }
 
@@ -883,50 +995,100 @@ void mapgen_unload_heightmap()
 
 /**
  * Applies box blur to the surface N times
+ * The 3x3 blur is done as a vertical sum of three rows followed by a sliding horizontal window over those sums.
  */
 static void mapgen_smooth_heightmap(uint8 *src, sint32 strength)
 {
+    const sint32 width = _heightMapData.width;
+    const sint32 height = _heightMapData.height;
+
     // Create buffer to store one channel
-    uint8 *dest = (uint8*)malloc(_heightMapData.width * _heightMapData.height);
+    uint8 *dest = (uint8*)malloc(width * height);
+    uint16 *columnSums = (uint16*)malloc(width * sizeof(uint16));
+    uint8 *read = src;
+    uint8 *write = dest;
 
     for (sint32 i = 0; i < strength; i++)
     {
         // Calculate box blur value to all pixels of the surface
-        for (uint32 y = 0; y < _heightMapData.height; y++)
+        for (sint32 y = 0; y < height; y++)
         {
-            for (uint32 x = 0; x < _heightMapData.width; x++)
+            // Clamp the rows so they stay within the image
+            // This assumes the height map is not tiled, and increases the weight of the edges
+            const uint8 *above = &read[max(y - 1, 0) * width];
+            const uint8 *row = &read[y * width];
+            const uint8 *below = &read[min(y + 1, height - 1) * width];
+            for (sint32 x = 0; x < width; x++)
             {
-                uint32 heightSum = 0;
+                columnSums[x] = above[x] + row[x] + below[x];
+            }
 
-                // Loop over neighbour pixels, all of them have the same weight
-                for (sint8 offsetX = -1; offsetX <= 1; offsetX++)
-                {
-                    for (sint8 offsetY = -1; offsetY <= 1; offsetY++)
-                    {
-                        // Clamp x and y so they stay within the image
-                        // This assumes the height map is not tiled, and increases the weight of the edges
-                        const sint32 readX = clamp((sint32)x + offsetX, 0, (sint32)_heightMapData.width - 1);
-                        const sint32 readY = clamp((sint32)y + offsetY, 0, (sint32)_heightMapData.height - 1);
-                        heightSum += src[readX + readY * _heightMapData.width];
-                    }
-                }
+            // Slide the window along the row, clamping the columns in the same way
+            uint8 *out = &write[y * width];
+            for (sint32 x = 0; x < width; x++)
+            {
+                uint32 heightSum = columnSums[max(x - 1, 0)] + columnSums[x] + columnSums[min(x + 1, width - 1)];
 
                 // Take average
-                dest[x + y * _heightMapData.width] = heightSum / 9;
+                out[x] = heightSum / 9;
             }
         }
 
-        // Now apply the blur to the source pixels
-        for (uint32 y = 0; y < _heightMapData.height; y++)
+        uint8 *tmp = read;
+        read = write;
+        write = tmp;
+    }
+
+    // Make sure the result ends up in the source pixels
+    if (read != src)
+    {
+        memcpy(src, read, width * height);
+    }
+
+    free(columnSums);
+    free(dest);
+}
+
+/**
+ * Keeps smoothing the surface until no tiles are changed anymore. A tile is only checked again when its own
+ * slope or a neighbour's height changed since it was last checked, as tile_smooth only depends on those.
+ * Tiles are still visited in the same order, so the result is the same as smoothing every tile on each pass.
+ */
+static void mapgen_smooth_surface(sint32 width, sint32 height)
+{
+    // Includes the edge tiles, so neighbours can be marked without bounds checks
+    const sint32 stride = width + 2;
+    uint8 *dirty = (uint8*)malloc(stride * (height + 2));
+    memset(dirty, 1, stride * (height + 2));
+
+    while (true)
+    {
+        uint32 numTilesChanged = 0;
+        for (sint32 y = 1; y <= height; y++)
         {
-            for (uint32 x = 0; x < _heightMapData.width; x++)
+            for (sint32 x = 1; x <= width; x++)
             {
-                src[x + y * _heightMapData.width] = dest[x + y * _heightMapData.width];
+                uint8 *tileDirty = &dirty[x + y * stride];
+                if (!*tileDirty)
+                    continue;
+
+                *tileDirty = 0;
+                if (tile_smooth(x, y))
+                {
+                    numTilesChanged++;
+                    for (sint32 offsetY = -1; offsetY <= 1; offsetY++)
+                    {
+                        memset(tileDirty + offsetY * stride - 1, 1, 3);
+                    }
+                }
             }
         }
+
+        if (numTilesChanged == 0)
+            break;
     }
 
-    free(dest);
+    free(dirty);
 }
 
 void mapgen_generate_from_heightmap(mapgen_settings *settings)
@@ -978,27 +1140,34 @@ void mapgen_generate_from_heightmap(mapgen_settings *settings)
     const uint8 rangeIn = maxValue - minValue;
     const uint8 rangeOut = settings->simplex_high - settings->simplex_low;
 
+    // Convert the input range to the output range once per value rather than once per pixel
+    uint8 heightLookup[256] = { 0 };
+    for (sint32 value = minValue; value <= maxValue; value++)
+    {
+        uint8 baseHeight = (uint8)((float)(value - minValue) / rangeIn * rangeOut) + settings->simplex_low;
+
+        // Floor to even number
+        heightLookup[value] = (baseHeight / 2) * 2;
+    }
+
+    const sint32 waterLevel = settings->water_level;
     for (uint32 y = 0; y < _heightMapData.height; y++)
     {
         for (uint32 x = 0; x < _heightMapData.width; x++)
         {
             // The x and y axis are flipped in the world, so this uses y for x and x for y.
-            rct_map_element *const surfaceElement = map_get_surface_element_at(y + 1, x + 1);
+            // map_init has just given every tile a lone surface element, so it is always the first element.
+            rct_map_element *const surfaceElement = map_get_first_element_at(y + 1, x + 1);
 
             // Read value from bitmap, and convert its range
-            uint8 value = dest[x + y * _heightMapData.width];
-            value = (uint8)((float)(value - minValue) / rangeIn * rangeOut) + settings->simplex_low;
-            surfaceElement->base_height = value;
-
-            // Floor to even number
-            surfaceElement->base_height /= 2;
-            surfaceElement->base_height *= 2;
-            surfaceElement->clearance_height = surfaceElement->base_height;
+            const uint8 baseHeight = heightLookup[dest[x + y * _heightMapData.width]];
+            surfaceElement->base_height = baseHeight;
+            surfaceElement->clearance_height = baseHeight;
 
             // Set water level
-            if (surfaceElement->base_height < settings->water_level)
+            if (baseHeight < waterLevel)
             {
-                surfaceElement->properties.surface.terrain |= settings->water_level / 2;
+                surfaceElement->properties.surface.terrain |= waterLevel / 2;
             }
         }
     }
@@ -1006,21 +1175,7 @@ void mapgen_generate_from_heightmap(mapgen_settings *settings)
     // Smooth map
     if (settings->smooth)
     {
-        // Keep smoothing the entire map until no tiles are changed anymore
-        while (true)
-        {
-            uint32 numTilesChanged = 0;
-            for (uint32 y = 1; y <= _heightMapData.height; y++)
-            {
-                for (uint32 x = 1; x <= _heightMapData.width; x++)
-                {
-                    numTilesChanged += tile_smooth(x, y);
-                }
-            }
-
-            if (numTilesChanged == 0)
-                break;
-        }
+        mapgen_smooth_surface(_heightMapData.width, _heightMapData.height);
     }
 
     // Clean up
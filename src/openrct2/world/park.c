@@ -35,6 +35,7 @@
 #include "../world/map.h"
 #include "entrance.h"
 #include "park.h"
+#include "ParkStats.h"
 #include "sprite.h"
 
 rct_string_id gParkName;
@@ -159,19 +160,7 @@ void park_reset_history()
  */
 sint32 park_calculate_size()
 {
-    sint32 tiles;
-    map_element_iterator it;
-
-    tiles = 0;
-    map_element_iterator_begin(&it);
-    do {
-        if (map_element_get_type(it.element) == MAP_ELEMENT_TYPE_SURFACE) {
-            if (it.element->properties.surface.ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) {
-                tiles++;
-            }
-        }
-    } while (map_element_iterator_next(&it));
-
+    sint32 tiles = park_stats_get_owned_tiles();
     if (tiles != gParkSize) {
         gParkSize = tiles;
         window_invalidate_by_class(WC_PARK_INFORMATION);
@@ -195,66 +184,38 @@ sint32 calculate_park_rating()
     if (gParkFlags & PARK_FLAGS_DIFFICULT_PARK_RATING)
         result = 1050;
 
+    const park_stats *stats = park_stats_get();
+
     // Guests
     {
-        rct_peep* peep;
-        uint16 spriteIndex;
-        sint32 num_happy_peeps;
-        sint32 num_lost_guests;
-
         // -150 to +3 based on a range of guests from 0 to 2000
         result -= 150 - (min(2000, gNumGuestsInPark) / 13);
 
-        // Find the number of happy peeps and the number of peeps who can't find the park exit
-        num_happy_peeps = 0;
-        num_lost_guests = 0;
-        FOR_ALL_GUESTS(spriteIndex, peep) {
-            if (peep->outside_of_park != 0)
-                continue;
-            if (peep->happiness > 128)
-                num_happy_peeps++;
-            if ((peep->peep_flags & PEEP_FLAGS_LEAVING_PARK) && (peep->peep_is_lost_countdown < 90))
-                num_lost_guests++;
-        }
-
         // Peep happiness -500 to +0
         result -= 500;
 
         if (gNumGuestsInPark > 0)
-            result += 2 * min(250, (num_happy_peeps * 300) / gNumGuestsInPark);
+            result += 2 * min(250, (stats->happy_guests * 300) / gNumGuestsInPark);
 
         // Up to 25 guests can be lost without affecting the park rating.
-        if (num_lost_guests > 25)
-            result -= (num_lost_guests - 25) * 7;
+        if (stats->lost_guests > 25)
+            result -= (stats->lost_guests - 25) * 7;
     }
 
     // Rides
     {
-        sint32 i;
-        sint16 total_ride_uptime = 0, total_ride_intensity = 0, total_ride_excitement = 0;
-        sint32 num_rides, num_exciting_rides = 0;
-        rct_ride* ride;
-
-        num_rides = 0;
-        FOR_ALL_RIDES(i, ride) {
-            total_ride_uptime += 100 - ride->downtime;
+        sint16 total_ride_excitement = stats->total_ride_excitement;
+        sint16 total_ride_intensity = stats->total_ride_intensity;
 
-            if (ride->excitement != RIDE_RATING_UNDEFINED){
-                total_ride_excitement += ride->excitement / 8;
-                total_ride_intensity += ride->intensity / 8;
-                num_exciting_rides++;
-            }
-            num_rides++;
-        }
         result -= 200;
-        if (num_rides > 0)
-            result += (total_ride_uptime / num_rides) * 2;
+        if (stats->rides > 0)
+            result += (stats->total_ride_uptime / stats->rides) * 2;
 
         result -= 100;
 
-        if (num_exciting_rides>0){
-            sint16 average_excitement = total_ride_excitement / num_exciting_rides;
-            sint16 average_intensity = total_ride_intensity / num_exciting_rides;
+        if (stats->rated_rides > 0) {
+            sint16 average_excitement = total_ride_excitement / stats->rated_rides;
+            sint16 average_intensity = total_ride_intensity / stats->rated_rides;
 
             average_excitement -= 46;
             if (average_excitement < 0){
@@ -277,51 +238,21 @@ sint32 calculate_park_rating()
     }
 
     // Litter
-    {
-        rct_litter* litter;
-        uint16 sprite_idx;
-        sint16 num_litter;
-
-        num_litter = 0;
-        for (sprite_idx = gSpriteListHead[SPRITE_LIST_LITTER]; sprite_idx != SPRITE_INDEX_NULL; sprite_idx = litter->next) {
-            litter = &(get_sprite(sprite_idx)->litter);
-
-            // Ignore recently dropped litter
-            if (litter->creationTick - gScenarioTicks >= 7680)
-                num_litter++;
-        }
-        result -= 600 - (4 * (150 - min(150, num_litter)));
-    }
+    result -= 600 - (4 * (150 - min(150, stats->old_litter)));
 
     result -= gParkRatingCasualtyPenalty;
     result = clamp(0, result, 999);
     return result;
 }
 
-static money32 calculate_ride_value(rct_ride *ride)
-{
-    if (ride->type == RIDE_TYPE_NULL)
-        return 0;
-    if (ride->value == RIDE_VALUE_UNDEFINED)
-        return 0;
-
-    // Fair value * (...)
-    return (ride->value * 10) * (ride_customers_in_last_5_minutes(ride) + rideBonusValue[ride->type] * 4);
-}
-
 /**
  *
  *  rct2: 0x0066A3F6
  */
 money32 calculate_park_value()
 {
-
     // Sum ride values
-    money32 result = 0;
-    for (sint32 i = 0; i < 255; i++) {
-        rct_ride* ride = get_ride(i);
-        result += calculate_ride_value(ride);
-    }
+    money32 result = park_stats_get()->total_ride_value;
 
     // +7.00 per guest
     result += gNumGuestsInPark * MONEY(7, 00);
@@ -1046,6 +977,7 @@ void game_command_buy_land_rights(sint32 *eax, sint32 *ebx, sint32 *ecx, sint32
 
 void set_forced_park_rating(sint32 rating){
     gForcedParkRating = rating;
+    park_stats_invalidate();
     gParkRating = calculate_park_rating();
     gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_PARK_RATING;
     window_invalidate_by_class(WC_PARK_INFORMATION);
@@ -23,6 +23,7 @@
 #include "../OpenRCT2.h"
 #include "../rct2/addresses.h"
 #include "../scenario/scenario.h"
+#include "AmenityField.h"
 #include "Fountain.h"
 #include "sprite.h"
 
@@ -40,6 +41,13 @@ static rct_sprite *_spriteList = RCT2_ADDRESS(RCT2_ADDRESS_SPRITE_LIST, rct_spri
 
 uint16 gSpriteSpatialIndex[0x10001];
 
+// A copy of the spatial index holding only vehicles, in the same order as they appear in gSpriteSpatialIndex, so
+// that vehicle collision detection does not have to walk past the peeps and litter sharing a tile
+static uint16 _vehicleSpatialIndex[SPATIAL_INDEX_LOCATION_NULL];
+static uint16 _vehicleNextInQuadrant[MAX_SPRITES];
+// The quadrant each vehicle is in, SPATIAL_INDEX_LOCATION_NULL if not in the vehicle index
+static uint32 _vehicleQuadrant[MAX_SPRITES];
+
 static rct_xyz16 _spritelocations1[MAX_SPRITES];
 static rct_xyz16 _spritelocations2[MAX_SPRITES];
 
@@ -67,6 +75,64 @@ uint16 sprite_get_first_in_quadrant(sint32 x, sint32 y)
     return gSpriteSpatialIndex[offset];
 }
 
+uint16 sprite_get_first_vehicle_in_quadrant(sint32 x, sint32 y)
+{
+    sint32 offset = ((x & 0x1FE0) << 3) | (y >> 5);
+    return _vehicleSpatialIndex[offset];
+}
+
+uint16 sprite_get_next_vehicle_in_quadrant(uint16 spriteIndex)
+{
+    return _vehicleNextInQuadrant[spriteIndex];
+}
+
+static void vehicle_spatial_index_insert(uint16 spriteIndex, size_t quadrant)
+{
+    _vehicleNextInQuadrant[spriteIndex] = _vehicleSpatialIndex[quadrant];
+    _vehicleSpatialIndex[quadrant] = spriteIndex;
+    _vehicleQuadrant[spriteIndex] = (uint32)quadrant;
+}
+
+static void vehicle_spatial_index_remove(uint16 spriteIndex)
+{
+    uint32 quadrant = _vehicleQuadrant[spriteIndex];
+    if (quadrant == SPATIAL_INDEX_LOCATION_NULL) {
+        return;
+    }
+
+    uint16 *nextIndex = &_vehicleSpatialIndex[quadrant];
+    while (*nextIndex != spriteIndex) {
+        nextIndex = &_vehicleNextInQuadrant[*nextIndex];
+    }
+    *nextIndex = _vehicleNextInQuadrant[spriteIndex];
+    _vehicleQuadrant[spriteIndex] = SPATIAL_INDEX_LOCATION_NULL;
+}
+
+/**
+ * Rebuilds the vehicle spatial index from gSpriteSpatialIndex, keeping the order of each quadrant.
+ */
+void reset_vehicle_spatial_index()
+{
+    memset(_vehicleSpatialIndex, 0xFF, sizeof(_vehicleSpatialIndex));
+    for (size_t i = 0; i < MAX_SPRITES; i++) {
+        _vehicleNextInQuadrant[i] = SPRITE_INDEX_NULL;
+        _vehicleQuadrant[i] = SPATIAL_INDEX_LOCATION_NULL;
+    }
+
+    for (uint32 quadrant = 0; quadrant < SPATIAL_INDEX_LOCATION_NULL; quadrant++) {
+        uint16 *tail = &_vehicleSpatialIndex[quadrant];
+        for (uint16 spriteIndex = gSpriteSpatialIndex[quadrant]; spriteIndex != SPRITE_INDEX_NULL; ) {
+            rct_sprite *sprite = get_sprite(spriteIndex);
+            if (sprite->unknown.sprite_identifier == SPRITE_IDENTIFIER_VEHICLE) {
+                *tail = spriteIndex;
+                tail = &_vehicleNextInQuadrant[spriteIndex];
+                _vehicleQuadrant[spriteIndex] = quadrant;
+            }
+            spriteIndex = sprite->unknown.next_in_quadrant;
+        }
+    }
+}
+
 static void invalidate_sprite_max_zoom(rct_sprite *sprite, sint32 maxZoom)
 {
     if (sprite->unknown.sprite_left == SPRITE_LOCATION_NULL) return;
@@ -172,6 +238,7 @@ void reset_sprite_spatial_index()
             spr->unknown.next_in_quadrant = nextSpriteId;
         }
     }
+    reset_vehicle_spatial_index();
 }
 
 static size_t GetSpatialIndexOffset(sint32 x, sint32 y)
@@ -540,12 +607,33 @@ void sprite_move(sint16 x, sint16 y, sint16 z, rct_sprite *sprite)
         sprite->unknown.next_in_quadrant = tempSpriteIndex;
     }
 
+    if (sprite->unknown.sprite_identifier == SPRITE_IDENTIFIER_LITTER) {
+        amenity_field_remove_litter(sprite->unknown.x, sprite->unknown.y);
+        amenity_field_add_litter(x, y);
+    }
+
+    // Vehicles join the vehicle index on their first move after being created
+    if (sprite->unknown.sprite_identifier == SPRITE_IDENTIFIER_VEHICLE) {
+        uint16 spriteIndex = sprite->unknown.sprite_index;
+        if (_vehicleQuadrant[spriteIndex] != newIndex) {
+            vehicle_spatial_index_remove(spriteIndex);
+            if (newIndex != SPATIAL_INDEX_LOCATION_NULL) {
+                vehicle_spatial_index_insert(spriteIndex, newIndex);
+            }
+        }
+    }
+
     if (x == SPRITE_LOCATION_NULL) {
         sprite->unknown.sprite_left = SPRITE_LOCATION_NULL;
         sprite->unknown.x = x;
         sprite->unknown.y = y;
         sprite->unknown.z = z;
     } else {
+        // Sprites appearing on the map, such as new guests, have no earlier position to tween from
+        if (sprite->unknown.x == SPRITE_LOCATION_NULL) {
+            uint16 spriteIndex = sprite->unknown.sprite_index;
+            _spritelocations1[spriteIndex] = _spritelocations2[spriteIndex] = (rct_xyz16){ x, y, z };
+        }
         sprite_set_coordinates(x, y, z, sprite);
     }
 }
@@ -586,6 +674,10 @@ void sprite_set_coordinates(sint16 x, sint16 y, sint16 z, rct_sprite *sprite){
  */
 void sprite_remove(rct_sprite *sprite)
 {
+    if (sprite->unknown.sprite_identifier == SPRITE_IDENTIFIER_LITTER) {
+        amenity_field_remove_litter(sprite->unknown.x, sprite->unknown.y);
+    }
+
     move_sprite_to_list(sprite, SPRITE_LIST_NULL * 2);
     user_string_free(sprite->unknown.name_string_idx);
     sprite->unknown.sprite_identifier = SPRITE_IDENTIFIER_NULL;
@@ -597,6 +689,8 @@ void sprite_remove(rct_sprite *sprite)
         spriteIndex = &quadrantSprite->unknown.next_in_quadrant;
     }
     *spriteIndex = sprite->unknown.next_in_quadrant;
+
+    vehicle_spatial_index_remove(sprite->unknown.sprite_index);
 }
 
 static bool litter_can_be_at(sint32 x, sint32 y, sint32 z)
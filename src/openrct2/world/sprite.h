@@ -421,6 +421,7 @@ extern uint16 gSpriteSpatialIndex[0x10001];
 rct_sprite *create_sprite(uint8 bl);
 void reset_sprite_list();
 void reset_sprite_spatial_index();
+void reset_vehicle_spatial_index();
 void sprite_clear_all_unused();
 void move_sprite_to_list(rct_sprite *sprite, uint8 cl);
 void sprite_misc_update_all();
@@ -435,6 +436,8 @@ void litter_remove_at(sint32 x, sint32 y, sint32 z);
 void sprite_misc_explosion_cloud_create(sint32 x, sint32 y, sint32 z);
 void sprite_misc_explosion_flare_create(sint32 x, sint32 y, sint32 z);
 uint16 sprite_get_first_in_quadrant(sint32 x, sint32 y);
+uint16 sprite_get_first_vehicle_in_quadrant(sint32 x, sint32 y);
+uint16 sprite_get_next_vehicle_in_quadrant(uint16 spriteIndex);
 void sprite_position_tween_store_a();
 void sprite_position_tween_store_b();
 void sprite_position_tween_all(float nudge);
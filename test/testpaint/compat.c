@@ -88,6 +88,10 @@ void scenery_paint(uint8 direction, int height, rct_map_element *mapElement) { }
 void fence_paint(uint8 direction, int height, rct_map_element *mapElement) { }
 void scenery_multiple_paint(uint8 direction, uint16 height, rct_map_element *mapElement) { }
 
+bool paint_tile_cache_begin(sint32 tileX, sint32 tileY, rct_map_element * firstElement) { return false; }
+void paint_tile_cache_end() { }
+void paint_tile_cache_set_dynamic() { }
+
 rct_ride *get_ride(int index) {
     if (index < 0 || index >= MAX_RIDES) {
         log_error("invalid index %d for ride", index);
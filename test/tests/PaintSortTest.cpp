@@ -0,0 +1,97 @@
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+extern "C"
+{
+    #include "openrct2/paint/paint_sort.h"
+}
+
+class PaintSortTest : public testing::Test
+{
+protected:
+    static constexpr uint32 NumQuadrants = 64;
+
+    std::vector<paint_struct> _structs;
+    paint_struct * _quadrants[NumQuadrants];
+    uint32 _backIndex;
+    uint32 _frontIndex;
+
+    // Fills the quadrants with paint structs that have small, often overlapping bounding boxes
+    void Generate(uint32 seed, size_t count)
+    {
+        std::mt19937 rng(seed);
+        _backIndex = rng() % (NumQuadrants / 2);
+        _frontIndex = _backIndex + 1 + rng() % (NumQuadrants / 2 - 1);
+
+        _structs.assign(count, paint_struct());
+        for (paint_struct &ps : _structs)
+        {
+            ps.var_18 = _backIndex + rng() % (_frontIndex - _backIndex + 1);
+            ps.bound_box_x = rng() % 96;
+            ps.bound_box_y = rng() % 96;
+            ps.bound_box_z = rng() % 64;
+            ps.bound_box_x_end = ps.bound_box_x + rng() % 32;
+            ps.bound_box_y_end = ps.bound_box_y + rng() % 32;
+            ps.bound_box_z_end = ps.bound_box_z + rng() % 32;
+        }
+        Link();
+    }
+
+    // Pushes the paint structs onto their quadrant lists in the same way as paint.c
+    void Link()
+    {
+        for (paint_struct * &quadrant : _quadrants)
+        {
+            quadrant = nullptr;
+        }
+        for (paint_struct &ps : _structs)
+        {
+            ps.var_1B = 0;
+            ps.next_quadrant_ps = _quadrants[ps.var_18];
+            _quadrants[ps.var_18] = &ps;
+        }
+    }
+
+    std::vector<size_t> GetOrder(const paint_struct &head)
+    {
+        std::vector<size_t> order;
+        for (const paint_struct * ps = head.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+        {
+            order.push_back(ps - _structs.data());
+        }
+        return order;
+    }
+};
+
+TEST_F(PaintSortTest, ArrayMatchesList)
+{
+    for (uint32 seed = 0; seed < 500; seed++)
+    {
+        Generate(seed, 1 + seed % 300);
+        for (uint8 rotation = 0; rotation < 4; rotation++)
+        {
+            paint_struct listHead = { 0 };
+            Link();
+            paint_sort_quadrants_list(&listHead, _quadrants, _backIndex, _frontIndex, rotation);
+            std::vector<size_t> expected = GetOrder(listHead);
+
+            paint_struct arrayHead = { 0 };
+            Link();
+            ASSERT_TRUE(paint_sort_quadrants(&arrayHead, _quadrants, _backIndex, _frontIndex, rotation));
+            std::vector<size_t> actual = GetOrder(arrayHead);
+
+            ASSERT_EQ(_structs.size(), expected.size());
+            ASSERT_EQ(expected, actual) << "seed " << seed << ", rotation " << (int)rotation;
+        }
+    }
+}
+
+TEST_F(PaintSortTest, EmptyQuadrants)
+{
+    _structs.clear();
+    Link();
+    paint_struct head = { 0 };
+    ASSERT_TRUE(paint_sort_quadrants(&head, _quadrants, 3, 10, 0));
+    ASSERT_EQ(nullptr, head.next_quadrant_ps);
+}
@@ -0,0 +1,195 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include "TestData.h"
+
+extern "C"
+{
+    #include <openrct2/game.h>
+    #include <openrct2/interface/viewport.h>
+    #include <openrct2/paint/paint.h>
+    #include <openrct2/platform/platform.h>
+    #include <openrct2/world/map.h>
+}
+
+using namespace OpenRCT2;
+
+/**
+ * Paints the same view of a park with and without the paint tile cache and checks the arranged paint
+ * struct lists match, both when the cache records the tiles and when it replays them on later ticks.
+ */
+class PaintTileCacheTest : public testing::Test
+{
+protected:
+    static const sint32 ViewWidth = 1024;
+    static const sint32 ViewHeight = 768;
+    static const sint32 NumTicks = 16;
+
+    static void AppendPointer(std::vector<uint32> &out, const void * pointer)
+    {
+        uint64 value = (uint64)(uintptr_t)pointer;
+        out.push_back((uint32)value);
+        out.push_back((uint32)(value >> 32));
+    }
+
+    static void AppendPaintStruct(std::vector<uint32> &out, const paint_struct * ps)
+    {
+        out.push_back(ps->image_id);
+        out.push_back(ps->tertiary_colour);
+        out.push_back(ps->bound_box_x);
+        out.push_back(ps->bound_box_y);
+        out.push_back(ps->bound_box_z);
+        out.push_back(ps->bound_box_z_end);
+        out.push_back(ps->bound_box_x_end);
+        out.push_back(ps->bound_box_y_end);
+        out.push_back(ps->x);
+        out.push_back(ps->y);
+        out.push_back(ps->var_18);
+        out.push_back(ps->flags);
+        out.push_back(ps->var_1B);
+        out.push_back(ps->sprite_type);
+        out.push_back(ps->var_29);
+        out.push_back(ps->map_x);
+        out.push_back(ps->map_y);
+        AppendPointer(out, ps->mapElement);
+
+        for (const attached_paint_struct * aps = ps->attached_ps; aps != nullptr; aps = aps->next)
+        {
+            out.push_back(aps->image_id);
+            out.push_back(aps->colour_image_id);
+            out.push_back(aps->x);
+            out.push_back(aps->y);
+            out.push_back(aps->flags);
+        }
+        out.push_back(UINT32_MAX);
+    }
+
+    static void AppendColumn(std::vector<uint32> &out, const paint_struct * head)
+    {
+        for (const paint_struct * ps = head->next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+        {
+            AppendPaintStruct(out, ps);
+            for (const paint_struct * childPs = ps->var_20; childPs != nullptr; childPs = childPs->var_20)
+            {
+                AppendPaintStruct(out, childPs);
+            }
+            out.push_back(UINT32_MAX);
+        }
+        for (const paint_string_struct * pss = gPaintPSStringHead; pss != nullptr; pss = pss->next)
+        {
+            out.push_back(pss->string_id);
+            out.push_back(pss->x);
+            out.push_back(pss->y);
+            for (uint32 arg : pss->args)
+            {
+                out.push_back(arg);
+            }
+        }
+    }
+
+    /**
+     * Paints a view the way viewport_paint does, in 32 pixel columns, and returns the arranged
+     * paint structs of every column.
+     */
+    static std::vector<uint32> PaintView(sint32 left, sint32 top, uint8 zoom)
+    {
+        std::vector<uint32> result;
+        sint32 width = ViewWidth << zoom;
+        sint32 height = ViewHeight << zoom;
+        for (sint32 x = floor2(left, 32); x < left + width; x += 32)
+        {
+            rct_drawpixelinfo dpi = { 0 };
+            dpi.x = x;
+            dpi.y = top;
+            dpi.width = 32;
+            dpi.height = height;
+            dpi.zoom_level = zoom;
+
+            gCurrentViewportFlags = 0;
+            paint_init(&dpi);
+            paint_generate_structs(&dpi);
+            paint_struct ps = paint_arrange_structs();
+            AppendColumn(result, &ps);
+        }
+        return result;
+    }
+};
+
+TEST_F(PaintTileCacheTest, CachedPaintMatchesUncached)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    game_load_sv6_path(path.c_str());
+
+    // Check ride count to check load was successful
+    ASSERT_EQ(gRideCount, 134);
+
+    Clock::duration uncachedTime = Clock::duration::zero();
+    Clock::duration cachedTime = Clock::duration::zero();
+    sint32 numFrames = 0;
+    for (uint8 rotation = 0; rotation < 4; rotation++)
+    {
+        gCurrentRotation = rotation;
+        for (uint8 zoom = 0; zoom < 3; zoom++)
+        {
+            // Centre the view on the middle of the map
+            rct_xyz16 centre;
+            centre.x = gMapSize * 16;
+            centre.y = gMapSize * 16;
+            centre.z = map_element_height(centre.x, centre.y) & 0xFFFF;
+            rct_xy16 screenCentre = coordinate_3d_to_2d(&centre, rotation);
+            sint32 left = screenCentre.x - ((ViewWidth << zoom) / 2);
+            sint32 top = screenCentre.y - ((ViewHeight << zoom) / 2);
+
+            gPaintTileCacheEnabled = false;
+            std::vector<uint32> expected = PaintView(left, top, zoom);
+
+            // The first cached paint records every tile
+            gPaintTileCacheEnabled = true;
+            paint_tile_cache_invalidate_all();
+            std::vector<uint32> recorded = PaintView(left, top, zoom);
+            ASSERT_EQ(expected.size(), recorded.size()) << "rotation " << (int)rotation << ", zoom " << (int)zoom;
+            ASSERT_TRUE(expected == recorded) << "rotation " << (int)rotation << ", zoom " << (int)zoom;
+
+            // Later ticks animate the park and move its sprites, so the tiles replayed from the cache
+            // must still match a fresh paint
+            for (sint32 tick = 0; tick < NumTicks; tick++)
+            {
+                game_logic_update();
+
+                gPaintTileCacheEnabled = false;
+                auto start = Clock::now();
+                expected = PaintView(left, top, zoom);
+                uncachedTime += Clock::now() - start;
+
+                gPaintTileCacheEnabled = true;
+                start = Clock::now();
+                std::vector<uint32> replayed = PaintView(left, top, zoom);
+                cachedTime += Clock::now() - start;
+                numFrames++;
+
+                ASSERT_EQ(expected.size(), replayed.size()) << "rotation " << (int)rotation << ", zoom " << (int)zoom << ", tick " << tick;
+                ASSERT_TRUE(expected == replayed) << "rotation " << (int)rotation << ", zoom " << (int)zoom << ", tick " << tick;
+            }
+        }
+    }
+
+    // Paint generation time per frame, the draw pass is the same either way
+    double uncachedMs = std::chrono::duration<double, std::milli>(uncachedTime).count() / numFrames;
+    double cachedMs = std::chrono::duration<double, std::milli>(cachedTime).count() / numFrames;
+    printf("Paint structs per frame: %.3f ms uncached, %.3f ms from the tile cache\n", uncachedMs, cachedMs);
+
+    delete context;
+}
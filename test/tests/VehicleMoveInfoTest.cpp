@@ -0,0 +1,57 @@
+#include <cstring>
+#include <gtest/gtest.h>
+
+extern "C"
+{
+    #include "openrct2/ride/track_data.h"
+    #include "openrct2/ride/vehicle.h"
+}
+
+// Number of pieces in each gTrackVehicleInfo table
+static constexpr uint16 TypeCounts[] = {
+    1024, 692, 404, 404, 404, 208, 208, 208, 208, 824, 824, 824, 824, 824, 824, 868, 868
+};
+static_assert(sizeof(TypeCounts) / sizeof(TypeCounts[0]) == sizeof(gTrackVehicleInfo) / sizeof(gTrackVehicleInfo[0]),
+              "TypeCounts needs a count for every gTrackVehicleInfo table");
+
+class VehicleMoveInfoTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        ASSERT_TRUE(vehicle_move_info_init());
+    }
+};
+
+TEST_F(VehicleMoveInfoTest, MatchesTrackVehicleInfo)
+{
+    for (sint32 cd = 0; cd < (sint32)(sizeof(TypeCounts) / sizeof(TypeCounts[0])); cd++)
+    {
+        for (sint32 typeAndDirection = 0; typeAndDirection < TypeCounts[cd]; typeAndDirection++)
+        {
+            const rct_vehicle_info_list * list = gTrackVehicleInfo[cd][typeAndDirection];
+            ASSERT_EQ(list->size, vehicle_get_move_info_size(cd, typeAndDirection)) << cd << ":" << typeAndDirection;
+            for (sint32 offset = 0; offset < list->size; offset++)
+            {
+                const rct_vehicle_info * info = vehicle_get_move_info(cd, typeAndDirection, offset);
+                ASSERT_EQ(0, std::memcmp(&list->info[offset], info, sizeof(rct_vehicle_info)))
+                    << cd << ":" << typeAndDirection << ":" << offset;
+            }
+        }
+    }
+}
+
+TEST_F(VehicleMoveInfoTest, OutOfRange)
+{
+    static const rct_vehicle_info zero = { 0 };
+
+    ASSERT_EQ(0, vehicle_get_move_info_size(-1, 0));
+    ASSERT_EQ(0, vehicle_get_move_info_size(17, 0));
+    ASSERT_EQ(0, vehicle_get_move_info_size(0, -1));
+    ASSERT_EQ(0, vehicle_get_move_info_size(1, TypeCounts[1]));
+
+    uint16 size = vehicle_get_move_info_size(0, 0);
+    ASSERT_EQ(0, std::memcmp(&zero, vehicle_get_move_info(0, 0, size), sizeof(rct_vehicle_info)));
+    ASSERT_EQ(0, std::memcmp(&zero, vehicle_get_move_info(0, 0, -1), sizeof(rct_vehicle_info)));
+    ASSERT_EQ(0, std::memcmp(&zero, vehicle_get_move_info(17, 0, 0), sizeof(rct_vehicle_info)));
+}